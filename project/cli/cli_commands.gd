@@ -37,6 +37,8 @@ func _register_commands() -> void:
 	_parser.add_command("message-capture", _cmd_message_capture, "Capture a test message to Sentry")
 	_parser.add_command("runtime-error-capture", _cmd_runtime_error_capture, "Capture Godot runtime error")
 	_parser.add_command("run-tests", _cmd_run_tests, "Run unit tests")
+	_parser.add_command("journal-dirty-exit", _cmd_journal_dirty_exit, "Write to the journal and exit without shutting down the SDK")
+	_parser.add_command("journal-report", _cmd_journal_report, "Write envelopes reported on startup, such as abnormal termination, to an NDJSON file")
 
 
 ## Shows available commands and their arguments.
@@ -124,6 +126,31 @@ func _cmd_runtime_error_capture() -> int:
 	return 0
 
 
+## Writes breadcrumbs and tags to the journal, then kills the process without shutting down the SDK.
+func _cmd_journal_dirty_exit() -> int:
+	await _init_sentry(func(options: SentryOptions) -> void:
+		options.journal = true
+	)
+	SentrySDK.add_breadcrumb(SentryBreadcrumb.create("journal-recovery-breadcrumb"))
+	SentrySDK.set_tag("journal.test", "dirty-exit")
+
+	print("Killing the process...")
+	OS.kill(OS.get_process_id())
+	return 1
+
+
+## Starts the SDK with the journal enabled, writing envelopes sent on startup to [param envelope_path].
+func _cmd_journal_report(envelope_path: String) -> int:
+	var transport := SentryFileTransport.new()
+	transport.path = envelope_path
+	await _init_sentry(func(options: SentryOptions) -> void:
+		options.journal = true
+		options.transport = transport
+	)
+	SentrySDK.close()
+	return 0
+
+
 func _cmd_run_tests(tests: String = "res://test/suites/") -> int:
 	if FileAccess.file_exists("res://test/util/test_runner.gd"):
 		print(">>> Initializing testing")
@@ -153,7 +180,8 @@ func _cmd_run_tests(tests: String = "res://test/suites/") -> int:
 
 
 ## Initializes Sentry for integration testing.
-func _init_sentry() -> void:
+## Optional [param configure] callback can adjust options further.
+func _init_sentry(configure := Callable()) -> void:
 	print("Initializing Sentry...")
 
 	SentrySDK.init(func(options: SentryOptions) -> void:
@@ -162,6 +190,8 @@ func _init_sentry() -> void:
 		options.release = "test-app@1.0.0"
 		options.environment = "integration-test"
 		options.dist = "test-dist"
+		if configure.is_valid():
+			configure.call(options)
 	)
 
 	# Wait for Sentry to initialize
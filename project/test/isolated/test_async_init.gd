@@ -0,0 +1,66 @@
+extends GdUnitTestSuite
+## Test starting the SDK in the background with async_init, and replaying calls made meanwhile.
+
+
+const RecordingTransport := preload("res://test/util/recording_transport.gd")
+
+
+func _init_sdk(async_init: bool, transport: SentryTransport = null) -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.async_init = async_init
+		options.transport = transport
+	)
+
+
+## Calls made while the SDK is starting should be replayed in order once it's ready.
+func test_calls_replayed_after_start(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	var transport := RecordingTransport.new()
+	_init_sdk(true, transport)
+	assert_bool(SentrySDK.is_enabled()).is_true()
+
+	SentrySDK.set_tag("async-tag", "replayed")
+	SentrySDK.add_breadcrumb(SentryBreadcrumb.create("async-breadcrumb"))
+	var event_id := SentrySDK.capture_message("async-init-message")
+	assert_str(event_id).is_not_empty()
+	assert_str(SentrySDK.get_last_event_id()).is_equal(event_id)
+
+	var envelope: String = await transport.await_envelope("async-init-message")
+	assert_str(envelope).contains("async-tag")
+	assert_str(envelope).contains("async-breadcrumb")
+	# ID returned before the event was captured should be the one it was sent with.
+	assert_str(envelope.replace("-", "")).contains(event_id.replace("-", ""))
+
+	SentrySDK.close()
+	assert_bool(SentrySDK.is_enabled()).is_false()
+
+
+## Closing right away should wait for the SDK to start, and deliver calls made meanwhile.
+func test_close_while_starting(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	var transport := RecordingTransport.new()
+	_init_sdk(true, transport)
+	SentrySDK.capture_message("closed-while-starting")
+	SentrySDK.close()
+
+	assert_bool(SentrySDK.is_enabled()).is_false()
+	assert_str(transport.find("closed-while-starting")).is_not_empty()
+
+
+## Benchmark: time SentrySDK.init() blocks the calling thread, with and without async_init.
+func test_benchmark_init(_do_skip = not OS.has_environment("SENTRY_BENCHMARKS") or not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	const ROUNDS := 3
+	var blocking_usec := 0
+	var async_usec := 0
+	for i in ROUNDS:
+		var start := Time.get_ticks_usec()
+		_init_sdk(false)
+		blocking_usec += Time.get_ticks_usec() - start
+		SentrySDK.close()
+
+		start = Time.get_ticks_usec()
+		_init_sdk(true)
+		async_usec += Time.get_ticks_usec() - start
+		SentrySDK.close()
+
+	print("SentrySDK.init(): %.1f ms blocking, %.1f ms with async_init" % [
+			blocking_usec / 1000.0 / ROUNDS, async_usec / 1000.0 / ROUNDS])
+	assert_int(async_usec).is_less(blocking_usec)
@@ -0,0 +1,58 @@
+extends GdUnitTestSuite
+## Test automatic transactions for resources requested with ResourceLoader.load_threaded_request().
+
+
+const RecordingTransport := preload("res://test/util/recording_transport.gd")
+const SCENE_PATH := "res://views/output_pane.tscn"
+const DEPENDENCY_PATH := "res://views/demo_output.gd"
+
+var _transport := RecordingTransport.new()
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.transport = _transport
+		options.traces_sample_rate = 1.0
+		options.trace_threaded_loads = true
+	)
+
+
+func after() -> void:
+	SentrySDK.close()
+
+
+func _find_transaction(envelope: String) -> Dictionary:
+	for line in envelope.split("\n", false):
+		var item: Variant = JSON.parse_string(line)
+		if item is Dictionary and item.get("type") == "transaction":
+			return item
+	return {}
+
+
+## Threaded load should be reported as a transaction once loading is done, without its dependencies.
+func test_threaded_load_transaction(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	assert_int(ResourceLoader.load_threaded_request(SCENE_PATH)).is_equal(OK)
+	while ResourceLoader.load_threaded_get_status(SCENE_PATH) == ResourceLoader.THREAD_LOAD_IN_PROGRESS:
+		await get_tree().process_frame
+
+	var scene := ResourceLoader.load_threaded_get(SCENE_PATH) as PackedScene
+	assert_object(scene).is_not_null()
+	assert_str(scene.resource_path).is_equal(SCENE_PATH)
+
+	# Completion is noticed in the next frame.
+	await get_tree().process_frame
+
+	var envelope := _transport.find("\"transaction\":\"%s\"" % SCENE_PATH)
+	assert_str(envelope).is_not_empty()
+	var transaction := _find_transaction(envelope)
+	assert_str(transaction.get("transaction", "")).is_equal(SCENE_PATH)
+	var trace: Dictionary = transaction.get("contexts", {}).get("trace", {})
+	assert_str(trace.get("op", "")).is_equal("resource.load")
+	# Transaction data ends up in the trace context.
+	var data: Dictionary = trace.get("data", {})
+	assert_str(data.get("resource.status", "")).is_equal("loaded")
+	assert_str(data.get("resource.type", "")).is_equal("PackedScene")
+	assert_int(int(data.get("resource.size", -1))).is_equal(FileAccess.get_file_as_bytes(SCENE_PATH).size())
+
+	# Dependencies loaded along with the requested resource are not reported.
+	assert_str(_transport.find("\"transaction\":\"%s\"" % DEPENDENCY_PATH)).is_empty()
@@ -0,0 +1,27 @@
+extends GdUnitTestSuite
+## Test routing envelopes through a SentryTransport implemented in GDScript.
+
+
+const RecordingTransport := preload("res://test/util/recording_transport.gd")
+
+var _transport := RecordingTransport.new()
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.transport = _transport
+	)
+
+
+## Custom transport should be started and receive serialized envelopes.
+func test_envelopes_routed_to_transport(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	assert_bool(_transport.started).is_true()
+
+	var event_id := SentrySDK.capture_message("custom-transport-message")
+	assert_str(event_id).is_not_empty()
+
+	var envelope := _transport.find("custom-transport-message")
+	assert_str(envelope).is_not_empty()
+	# Envelope header is the first line.
+	var header: Variant = JSON.parse_string(envelope.get_slice("\n", 0))
+	assert_bool(header is Dictionary and header.get("event_id", "").replace("-", "") == event_id.replace("-", "")).is_true()
@@ -0,0 +1,58 @@
+extends GdUnitTestSuite
+## Test writing envelopes to an NDJSON file, and uploading them later.
+
+
+const ENVELOPES_PATH := "user://test_file_transport/envelopes.ndjson"
+const UPLOAD_PATH := "user://test_file_transport/upload.ndjson"
+
+var _ingestion := MockIngestion.new()
+
+
+func before() -> void:
+	DirAccess.remove_absolute(ENVELOPES_PATH)
+	_ingestion.start()
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		var transport := SentryFileTransport.new()
+		transport.path = ENVELOPES_PATH
+		options.transport = transport
+	)
+
+
+func after() -> void:
+	_ingestion.stop()
+
+
+func _read_envelopes() -> Array[String]:
+	var envelopes: Array[String] = []
+	for line in FileAccess.get_file_as_string(ENVELOPES_PATH).split("\n", false):
+		var entry: Dictionary = JSON.parse_string(line)
+		envelopes.append(Marshalls.base64_to_raw(entry["envelope"]).get_string_from_utf8())
+	return envelopes
+
+
+## Each envelope should be written as one NDJSON line, and uploaded as is by reupload().
+func test_write_and_reupload(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	SentrySDK.capture_message("file-transport-message")
+
+	var envelopes := _read_envelopes()
+	assert_bool(envelopes.any(func(e: String) -> bool: return e.contains("file-transport-message"))).is_true()
+
+	# The file is still in use by the transport, so a copy is uploaded.
+	DirAccess.copy_absolute(ENVELOPES_PATH, UPLOAD_PATH)
+
+	# Upload from another thread, as the stand-in endpoint is served on this one.
+	var dsn := _ingestion.get_dsn()
+	var thread := Thread.new()
+	thread.start(func() -> int: return SentryFileTransport.reupload(UPLOAD_PATH, dsn))
+	while thread.is_alive():
+		_ingestion.serve()
+		await get_tree().process_frame
+	var uploaded: int = thread.wait_to_finish()
+
+	assert_int(uploaded).is_equal(envelopes.size())
+	var request := _ingestion.find_request("file-transport-message")
+	assert_dict(request).is_not_empty()
+	assert_str(request["head"]).starts_with("POST /api/42/envelope/ HTTP/1.1")
+
+	# Uploaded envelopes are removed from the file.
+	assert_str(FileAccess.get_file_as_string(UPLOAD_PATH)).is_empty()
@@ -0,0 +1,44 @@
+extends GdUnitTestSuite
+## Test SentrySDK.flush() and shutdown options.
+
+
+const RecordingTransport := preload("res://test/util/recording_transport.gd")
+
+
+func after_test() -> void:
+	SentrySDK.close()
+
+
+## Flushing should deliver events captured so far before returning.
+func test_flush_delivers_events(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	var transport := RecordingTransport.new()
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.transport = transport
+	)
+
+	SentrySDK.capture_message("flushed-message")
+	assert_bool(SentrySDK.flush(5000)).is_true()
+	assert_bool(transport.flushed).is_true()
+	assert_str(transport.find("flushed-message")).is_not_empty()
+
+
+## Flushing a disabled SDK should fail without blocking.
+func test_flush_when_disabled() -> void:
+	SentrySDK.close()
+	var start := Time.get_ticks_msec()
+	assert_bool(SentrySDK.flush(1000)).is_false()
+	assert_int(Time.get_ticks_msec() - start).is_less(1000)
+
+
+## With persist_on_shutdown, closing shouldn't wait for the transport.
+func test_persist_on_shutdown(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.persist_on_shutdown = true
+		options.transport_spooling = true
+	)
+	SentrySDK.capture_message("persisted-message")
+
+	var start := Time.get_ticks_msec()
+	SentrySDK.close()
+	print("SentrySDK.close() with persist_on_shutdown: %d ms" % (Time.get_ticks_msec() - start))
+	assert_int(Time.get_ticks_msec() - start).is_less(1000)
@@ -0,0 +1,82 @@
+extends GdUnitTestSuite
+## Test reporting a previous session that ended without shutting down, using the journal.
+##
+## Sessions run in child processes with CLI commands: one is killed while the SDK is running,
+## and the next one writes the envelopes it sends on startup to a file.
+
+const JOURNAL_PATH := "user://sentry/journal.bin"
+const ENVELOPES_PATH := "user://test_journal_envelopes.ndjson"
+const ABNORMAL_TERMINATION := "Abnormal termination"
+
+
+func _run_command(args: Array[String]) -> void:
+	var full_args := PackedStringArray(["--headless", "--path", ProjectSettings.globalize_path("res://"), "--"])
+	full_args.append_array(args)
+	OS.execute(OS.get_executable_path(), full_args)
+
+
+func _dirty_exit() -> void:
+	_run_command(["journal-dirty-exit"])
+	assert_bool(FileAccess.file_exists(JOURNAL_PATH)).is_true()
+
+
+## Starts a new session and returns envelopes it sent on startup.
+func _report() -> Array[String]:
+	DirAccess.remove_absolute(ProjectSettings.globalize_path(ENVELOPES_PATH))
+	_run_command(["journal-report", ProjectSettings.globalize_path(ENVELOPES_PATH)])
+
+	var envelopes: Array[String] = []
+	var file := FileAccess.open(ENVELOPES_PATH, FileAccess.READ)
+	while file != null and not file.eof_reached():
+		var line: Variant = JSON.parse_string(file.get_line())
+		if line is Dictionary:
+			envelopes.append(Marshalls.base64_to_raw(line["envelope"]).get_string_from_utf8())
+	return envelopes
+
+
+func _find(envelopes: Array[String], needle: String) -> String:
+	for envelope in envelopes:
+		if envelope.contains(needle):
+			return envelope
+	return ""
+
+
+## Killed session should be reported once, with breadcrumbs and tags recovered from the journal.
+func test_dirty_exit_reported(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	_dirty_exit()
+
+	var envelope := _find(_report(), ABNORMAL_TERMINATION)
+	assert_str(envelope).is_not_empty()
+	assert_str(envelope).contains("journal-recovery-breadcrumb")
+	assert_str(envelope).contains("dirty-exit")
+
+	# The reporting session shut down cleanly -- nothing to report next time.
+	assert_str(_find(_report(), ABNORMAL_TERMINATION)).is_empty()
+
+
+## Session flagged by the crash handler is reported as a crash, not as abnormal termination.
+func test_crashed_session_not_reported(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	_dirty_exit()
+
+	# Set the "crashed" flag in the journal header, as the crash handler does with mark_crashed().
+	var file := FileAccess.open(JOURNAL_PATH, FileAccess.READ_WRITE)
+	file.seek(24)
+	file.store_32(1)
+	file.close()
+
+	assert_str(_find(_report(), ABNORMAL_TERMINATION)).is_empty()
+
+
+## Truncated or corrupted journal should be discarded without reporting anything.
+func test_truncated_journal_discarded(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	_dirty_exit()
+
+	var file := FileAccess.open(JOURNAL_PATH, FileAccess.WRITE)
+	file.store_string("SGJR")
+	file.close()
+
+	var envelopes := _report()
+	assert_str(_find(envelopes, ABNORMAL_TERMINATION)).is_empty()
+	# Journal is usable again afterwards.
+	_dirty_exit()
+	assert_str(_find(_report(), "journal-recovery-breadcrumb")).is_not_empty()
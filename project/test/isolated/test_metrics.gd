@@ -0,0 +1,133 @@
+extends GdUnitTestSuite
+## Test metrics aggregation with enable_metrics set to true.
+
+
+const RecordingTransport := preload("res://test/util/recording_transport.gd")
+
+var _transport := RecordingTransport.new()
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.enable_metrics = true
+		options.metrics_flush_interval_sec = 3600
+		options.transport = _transport
+		options.before_send = _before_send
+	)
+
+
+func _before_send(ev: SentryEvent) -> SentryEvent:
+	if ev.message.begins_with("metrics-dropped"):
+		return null
+	return ev
+
+
+func before_test() -> void:
+	SentrySDK.metrics.flush()
+
+
+## Values should be aggregated per type, name and tags.
+func test_aggregation() -> void:
+	SentrySDK.metrics.increment("spawned")
+	SentrySDK.metrics.increment("spawned", 2.0)
+	SentrySDK.metrics.gauge("players", 3, {"room": "lobby", "mode": "coop"})
+	SentrySDK.metrics.gauge("players", 5, {"mode": "coop", "room": "lobby"})
+	SentrySDK.metrics.gauge("players", 1, {"room": "arena"})
+	SentrySDK.metrics.distribution("path_ms", 2.0)
+	SentrySDK.metrics.distribution("path_ms", 6.0)
+	SentrySDK.metrics.add_to_set("unique_players", "alice")
+	SentrySDK.metrics.add_to_set("unique_players", "bob")
+	SentrySDK.metrics.add_to_set("unique_players", "alice")
+
+	var values: Dictionary = SentrySDK.metrics.flush().get("values")
+	assert_int(values.size()).is_equal(5)
+	assert_float(values["c:spawned"]).is_equal(3.0)
+	assert_array(values["g:players|mode=coop,room=lobby"]).is_equal([5.0, 3.0, 5.0, 8.0, 2])
+	assert_array(values["g:players|room=arena"]).is_equal([1.0, 1.0, 1.0, 1.0, 1])
+	assert_array(values["d:path_ms"]).is_equal([2, 8.0, 2.0, 6.0])
+	assert_int(values["s:unique_players"]).is_equal(2)
+
+
+## Tags should be aggregated by key and string value, regardless of key and value types.
+func test_tag_types() -> void:
+	SentrySDK.metrics.increment(&"tagged", 1.0, {&"room": "lobby", &"level": 1})
+	SentrySDK.metrics.increment("tagged", 1.0, {"level": "1", "room": &"lobby"})
+
+	var values: Dictionary = SentrySDK.metrics.flush().get("values")
+	assert_int(values.size()).is_equal(1)
+	assert_float(values["c:tagged|level=1,room=lobby"]).is_equal(2.0)
+
+
+## Flushed batch should be attached to the next event only.
+func test_batch_attached_once(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	SentrySDK.metrics.increment("attached")
+	SentrySDK.metrics.flush()
+	SentrySDK.capture_message("metrics-first-event")
+	SentrySDK.capture_message("metrics-second-event")
+
+	assert_str(_transport.find("metrics-first-event")).contains("\"c:attached\"")
+	var second := _transport.find("metrics-second-event")
+	assert_str(second).is_not_empty()
+	assert_str(second).not_contains("c:attached")
+
+
+## Batches not taken by an event should be merged, not replaced.
+func test_unclaimed_batches_merged(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	SentrySDK.metrics.increment("merged_first")
+	SentrySDK.metrics.flush()
+	SentrySDK.metrics.increment("merged_second")
+	SentrySDK.metrics.flush()
+	SentrySDK.capture_message("metrics-merged-event")
+
+	var envelope := _transport.find("metrics-merged-event")
+	assert_str(envelope).contains("\"c:merged_first\"")
+	assert_str(envelope).contains("\"c:merged_second\"")
+
+
+## Events dropped in before_send should leave the batch for the next event.
+func test_batch_kept_on_drop(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	SentrySDK.metrics.increment("kept")
+	SentrySDK.metrics.flush()
+	SentrySDK.capture_message("metrics-dropped-event")
+	SentrySDK.capture_message("metrics-kept-event")
+
+	assert_str(_transport.find("metrics-dropped-event")).is_empty()
+	assert_str(_transport.find("metrics-kept-event")).contains("\"c:kept\"")
+
+
+## Flushing should start a new interval.
+func test_flush_resets() -> void:
+	SentrySDK.metrics.increment("spawned")
+	assert_dict(SentrySDK.metrics.flush()).is_not_empty()
+	assert_dict(SentrySDK.metrics.flush()).is_empty()
+
+
+## Values recorded on other threads should be merged, including threads that already exited.
+func test_threads(_do_skip = OS.get_name() == "Web") -> void:
+	var threads: Array[Thread] = []
+	for i in 4:
+		var thread := Thread.new()
+		thread.start(func() -> void:
+			for j in 1000:
+				SentrySDK.metrics.increment("threaded")
+		)
+		threads.append(thread)
+	for thread in threads:
+		thread.wait_to_finish()
+	SentrySDK.metrics.increment("threaded")
+
+	var values: Dictionary = SentrySDK.metrics.flush().get("values")
+	assert_float(values["c:threaded"]).is_equal(4001.0)
+
+
+## Benchmark: per-call cost of recording a metric, including the script call overhead.
+func test_benchmark_increment(_do_skip = not OS.has_environment("SENTRY_BENCHMARKS")) -> void:
+	const CALLS := 100_000
+	var start := Time.get_ticks_usec()
+	for i in CALLS:
+		SentrySDK.metrics.increment(&"benchmark")
+	var elapsed := Time.get_ticks_usec() - start
+	print("SentryMetrics.increment(): %.1f ns per call" % [elapsed * 1000.0 / CALLS])
+
+	var values: Dictionary = SentrySDK.metrics.flush().get("values")
+	assert_float(values["c:benchmark"]).is_equal(float(CALLS))
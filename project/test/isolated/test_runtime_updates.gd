@@ -0,0 +1,95 @@
+extends GdUnitTestSuite
+## Test updating limits and sample rates while the SDK is running.
+
+
+var _num_events: int = 0
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.logger_limits.events_per_frame = 88
+		options.logger_limits.repeated_error_window_ms = 0
+		options.logger_limits.throttle_events = 88
+		options.before_send = _before_send
+	)
+
+
+func _before_send(ev: SentryEvent) -> SentryEvent:
+	if ev.is_crash():
+		# Likely processing previous crash.
+		return ev
+	_num_events += 1
+	return null
+
+
+## Lowered limits should apply from the next frame.
+func test_update_limits() -> void:
+	# Wait for special startup limits to expire.
+	while Engine.get_process_frames() < 10:
+		await get_tree().process_frame
+
+	var limits := SentryLoggerLimits.new()
+	limits.events_per_frame = 1
+	limits.repeated_error_window_ms = 0
+	limits.throttle_events = 88
+	SentrySDK.update_limits(limits)
+	await get_tree().process_frame
+
+	_num_events = 0
+	push_error("limited-error")
+	push_error("limited-error")
+	push_error("limited-error")
+	await get_tree().create_timer(0.1).timeout
+	assert_int(_num_events).is_equal(1)
+
+
+## Negative limits should be clamped to 0, which disables the throttling window.
+func test_update_limits_clamped() -> void:
+	while Engine.get_process_frames() < 10:
+		await get_tree().process_frame
+
+	var limits := SentryLoggerLimits.new()
+	limits.events_per_frame = 88
+	limits.repeated_error_window_ms = 0
+	limits.throttle_events = 1
+	limits.throttle_window_ms = -1
+	SentrySDK.update_limits(limits)
+	await get_tree().process_frame
+
+	_num_events = 0
+	push_error("unthrottled-error")
+	push_error("unthrottled-error")
+	await get_tree().create_timer(0.1).timeout
+	assert_int(_num_events).is_equal(2)
+
+
+## Limits should still be picked up after many updates, as replaced options are reclaimed.
+func test_repeated_updates() -> void:
+	while Engine.get_process_frames() < 10:
+		await get_tree().process_frame
+
+	var limits := SentryLoggerLimits.new()
+	limits.repeated_error_window_ms = 0
+	limits.throttle_events = 88
+	for i in 100:
+		limits.events_per_frame = 50 + i
+		SentrySDK.update_limits(limits)
+		SentrySDK.update_sampling(1.0, 0.0)
+	limits.events_per_frame = 2
+	SentrySDK.update_limits(limits)
+	await get_tree().process_frame
+
+	_num_events = 0
+	for i in 3:
+		push_error("limited-error")
+	await get_tree().create_timer(0.1).timeout
+	assert_int(_num_events).is_equal(2)
+
+
+## Events should be sampled out right after the sample rate is lowered, and captured again once it's restored.
+func test_update_sampling() -> void:
+	SentrySDK.update_sampling(0.0, 0.0)
+	assert_str(SentrySDK.capture_message("sampled-out")).is_empty()
+
+	SentrySDK.update_sampling(1.0, 0.0)
+	assert_str(SentrySDK.capture_message("sampled-in")).is_not_empty()
@@ -0,0 +1,139 @@
+extends GdUnitTestSuite
+## Test the scene tree attached to events with attach_scene_tree.
+
+
+const RecordingTransport := preload("res://test/util/recording_transport.gd")
+
+var _transport: RecordingTransport
+var _nodes: Array[Node] = []
+
+
+func _init_sdk(max_nodes: int = 0, max_depth: int = 0, mirror: bool = false) -> void:
+	_transport = RecordingTransport.new()
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.transport = _transport
+		options.attach_scene_tree = true
+		options.scene_tree_max_nodes = max_nodes
+		options.scene_tree_max_depth = max_depth
+		options.scene_tree_time_budget_ms = 0
+		options.scene_tree_mirror = mirror
+	)
+
+
+func _add_node(node_name: String, parent: Node = null) -> Node:
+	var node := Node.new()
+	node.name = node_name
+	if parent:
+		parent.add_child(node)
+	else:
+		get_tree().root.add_child(node)
+		_nodes.append(node)
+	return node
+
+
+func after_test() -> void:
+	SentrySDK.close()
+	for node in _nodes:
+		if is_instance_valid(node):
+			node.free()
+	_nodes.clear()
+
+
+## Captures an event and returns its parsed view hierarchy.
+func _capture_scene_tree(message: String) -> Dictionary:
+	SentrySDK.capture_message(message)
+	var envelope := _transport.find(message)
+	for line in envelope.split("\n"):
+		if line.begins_with("{\"rendering_system\""):
+			var parsed: Variant = JSON.parse_string(line)
+			return parsed if parsed is Dictionary else {}
+	return {}
+
+
+func _find_node(node: Dictionary, node_name: String) -> Dictionary:
+	if node.get("name") == node_name:
+		return node
+	for child: Dictionary in node.get("children", []):
+		var found := _find_node(child, node_name)
+		if not found.is_empty():
+			return found
+	return {}
+
+
+func _count_nodes(node: Dictionary) -> int:
+	var count := 1
+	for child: Dictionary in node.get("children", []):
+		count += _count_nodes(child)
+	return count
+
+
+## Names and paths with control characters, quotes, backslashes and non-BMP characters should produce valid JSON.
+func test_json_escaping(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	_init_sdk()
+	var node := _add_node("ctl" + char(1) + char(9) + "back\\slash 🎮 é")
+	node.scene_file_path = "res://\"quoted\".tscn"
+
+	var tree := _capture_scene_tree("scene-tree-escaping")
+	assert_dict(tree).is_not_empty()
+	assert_bool(tree.has("truncated")).is_false()
+
+	var captured := _find_node(tree["windows"][0], String(node.name))
+	assert_dict(captured).is_not_empty()
+	assert_str(captured.get("scene")).is_equal("res://\"quoted\".tscn")
+	assert_str(captured.get("class")).is_equal("Node")
+
+
+## Hitting scene_tree_max_nodes should close the output cleanly and mark it as truncated.
+func test_truncated_at_max_nodes(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	_init_sdk(3)
+	var parent := _add_node("max-nodes-parent")
+	for i in 5:
+		_add_node("max-nodes-child-%d" % i, parent)
+
+	var tree := _capture_scene_tree("scene-tree-max-nodes")
+	assert_dict(tree).is_not_empty()
+	assert_bool(tree.get("truncated", false)).is_true()
+	assert_int(_count_nodes(tree["windows"][0])).is_less_equal(3)
+
+
+## Children below scene_tree_max_depth should be omitted, and the output marked as truncated.
+func test_truncated_at_max_depth(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	_init_sdk(0, 1)
+	var parent := _add_node("max-depth-parent")
+	_add_node("max-depth-child", parent)
+
+	var tree := _capture_scene_tree("scene-tree-max-depth")
+	assert_dict(tree).is_not_empty()
+	assert_bool(tree.get("truncated", false)).is_true()
+
+	var captured := _find_node(tree["windows"][0], "max-depth-parent")
+	assert_dict(captured).is_not_empty()
+	assert_bool(captured.has("children")).is_false()
+	assert_dict(_find_node(tree["windows"][0], "max-depth-child")).is_empty()
+
+
+## Mirror should reflect nodes added, renamed and removed after it was built.
+func test_mirror_tracks_changes(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	_init_sdk(0, 0, true)
+	# Mirror starts deferred.
+	await get_tree().process_frame
+
+	var node := _add_node("mirror-added")
+	var child := _add_node("mirror-child", node)
+	var tree := _capture_scene_tree("scene-tree-mirror-added")
+	var captured := _find_node(tree["windows"][0], "mirror-added")
+	assert_dict(captured).is_not_empty()
+	assert_dict(_find_node(captured, "mirror-child")).is_not_empty()
+
+	node.name = "mirror-renamed"
+	tree = _capture_scene_tree("scene-tree-mirror-renamed")
+	assert_dict(_find_node(tree["windows"][0], "mirror-added")).is_empty()
+	assert_dict(_find_node(tree["windows"][0], "mirror-renamed")).is_not_empty()
+
+	node.remove_child(child)
+	child.free()
+	get_tree().root.remove_child(node)
+	tree = _capture_scene_tree("scene-tree-mirror-removed")
+	assert_dict(tree).is_not_empty()
+	assert_dict(_find_node(tree["windows"][0], "mirror-renamed")).is_empty()
+	assert_dict(_find_node(tree["windows"][0], "mirror-child")).is_empty()
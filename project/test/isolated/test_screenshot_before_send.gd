@@ -0,0 +1,45 @@
+extends GdUnitTestSuite
+## Test that screenshots are only produced for events accepted by before_send.
+
+
+const RecordingTransport := preload("res://test/util/recording_transport.gd")
+
+var _transport := RecordingTransport.new()
+var _screenshot_requests: Array[String] = []
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.transport = _transport
+		options.attach_screenshot = true
+		options.screenshot_level = SentrySDK.LEVEL_DEBUG
+		options.before_send = _before_send
+		options.before_capture_screenshot = _before_capture_screenshot
+	)
+
+
+func after() -> void:
+	SentrySDK.close()
+
+
+func _before_send(event: SentryEvent) -> SentryEvent:
+	return null if event.message.begins_with("dropped") else event
+
+
+func _before_capture_screenshot(event: SentryEvent) -> bool:
+	_screenshot_requests.append(event.message)
+	return true
+
+
+## Event dropped by before_send should not get to screenshot capture.
+func test_dropped_event_captures_no_screenshot(_do_skip = DisplayServer.get_name() == "headless" or not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	await get_tree().process_frame
+	SentrySDK.capture_message("dropped-message")
+	assert_array(_screenshot_requests).is_empty()
+	assert_str(_transport.find("dropped-message")).is_empty()
+
+	# Accepted event in the next frame still gets its screenshot.
+	await get_tree().process_frame
+	SentrySDK.capture_message("accepted-message")
+	assert_array(_screenshot_requests).contains_exactly(["accepted-message"])
+	assert_str(_transport.find("accepted-message")).contains("screenshot.jpg")
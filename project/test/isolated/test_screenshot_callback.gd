@@ -0,0 +1,62 @@
+extends GdUnitTestSuite
+## Test that before_capture_screenshot applies to each event, including those captured in the same frame.
+
+
+const RecordingTransport := preload("res://test/util/recording_transport.gd")
+
+var _transport := RecordingTransport.new()
+var _callback_calls: Array[String] = []
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.transport = _transport
+		options.attach_screenshot = true
+		options.screenshot_level = SentrySDK.LEVEL_DEBUG
+		options.before_capture_screenshot = _before_capture_screenshot
+	)
+
+
+func after() -> void:
+	SentrySDK.close()
+
+
+func before_test() -> void:
+	_callback_calls.clear()
+
+
+func _before_capture_screenshot(event: SentryEvent) -> bool:
+	_callback_calls.append(event.message)
+	if event.message.contains("slow"):
+		OS.delay_msec(200)
+	return event.message.begins_with("screenshot-allowed")
+
+
+## Second event in a frame must not reuse the screenshot if the callback rejects it.
+func test_callback_applies_to_each_event_in_frame(_do_skip = DisplayServer.get_name() == "headless" or not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	await get_tree().process_frame
+
+	var frame := Engine.get_frames_drawn()
+	SentrySDK.capture_message("screenshot-allowed-message")
+	SentrySDK.capture_message("screenshot-rejected-message")
+	SentrySDK.capture_message("screenshot-allowed-again-message")
+	assert_int(Engine.get_frames_drawn()).is_equal(frame)
+
+	assert_array(_callback_calls).contains_exactly([
+			"screenshot-allowed-message",
+			"screenshot-rejected-message",
+			"screenshot-allowed-again-message"])
+	assert_str(_transport.find("screenshot-allowed-message")).contains("screenshot.jpg")
+	assert_str(_transport.find("screenshot-rejected-message")).is_not_empty()
+	assert_str(_transport.find("screenshot-rejected-message")).not_contains("screenshot.jpg")
+	assert_str(_transport.find("screenshot-allowed-again-message")).contains("screenshot.jpg")
+
+
+## Time spent in the callback should be recorded for the callback, not for the screenshot processor.
+func test_callback_timed_separately(_do_skip = DisplayServer.get_name() == "headless" or not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	await get_tree().process_frame
+	SentrySDK.capture_message("screenshot-allowed-slow-message")
+
+	var stats: Dictionary = SentrySDK.get_processing_stats()
+	assert_int(stats["before_capture_screenshot"]["last_usec"]).is_greater_equal(200_000)
+	assert_int(stats["ScreenshotProcessor"]["last_usec"]).is_less(200_000)
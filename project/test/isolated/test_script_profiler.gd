@@ -0,0 +1,36 @@
+extends GdUnitTestSuite
+## Test script profiler sampling at SDK calls.
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.script_profiler = true
+		options.script_profiler_interval_ms = 1
+		options.script_profiler_max_overhead = 10.0
+	)
+
+
+func _busy_with_breadcrumbs() -> void:
+	for i in 100:
+		SentrySDK.add_breadcrumb(SentryBreadcrumb.create("profiled"))
+		OS.delay_usec(2000)
+
+
+## Samples taken at SDK calls should be aggregated into folded stacks.
+func test_script_profile(_do_skip = OS.get_name() == "Web") -> void:
+	_busy_with_breadcrumbs()
+
+	var profile: Dictionary = SentrySDK._get_script_profile()
+	assert_int(profile.get("samples", 0)).is_greater(0)
+	assert_int(profile.get("interval_ms")).is_equal(1)
+	# Samples are taken at the next SDK call, about 2 ms after being requested here;
+	# the bound leaves room for the sampler thread being scheduled late.
+	assert_float(profile.get("mean_delay_ms", -1.0)).is_between(0.0, 20.0)
+
+	var stacks: Array = profile.get("stacks", [])
+	assert_array(stacks).is_not_empty()
+	var top: String = stacks[0]
+	assert_str(top).contains("_busy_with_breadcrumbs (res://test/isolated/test_script_profiler.gd:")
+	assert_str(top).contains("test_script_profile (res://test/isolated/test_script_profiler.gd:")
+	# Leaf frame comes last, followed by the sample count.
+	assert_bool(top.get_slice(";", top.get_slice_count(";") - 1).begins_with("_busy_with_breadcrumbs")).is_true()
@@ -0,0 +1,24 @@
+extends GdUnitTestSuite
+## Test transactions with traces_sample_rate set to 1.0.
+
+
+func before() -> void:
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.traces_sample_rate = 1.0
+	)
+
+
+## Each sampled transaction should be a distinct object that tracks its own state.
+func test_sampled_transaction(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	var transaction := SentrySDK.start_transaction("test-transaction", "test")
+	assert_str(transaction.get_name()).is_equal("test-transaction")
+	assert_object(transaction).is_not_same(SentrySDK.start_transaction("test-transaction", "test"))
+
+	var span := transaction.start_child("test.child", "child span")
+	span.set_data("answer", 42)
+	assert_bool(span.is_finished()).is_false()
+	span.finish()
+	assert_bool(span.is_finished()).is_true()
+
+	transaction.finish()
+	assert_bool(transaction.is_finished()).is_true()
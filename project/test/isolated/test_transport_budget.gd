@@ -0,0 +1,54 @@
+extends GdUnitTestSuite
+## Test byte budget of the spooling transport against a local stand-in for the ingestion endpoint.
+
+
+var _ingestion := MockIngestion.new()
+
+
+func before() -> void:
+	_ingestion.start()
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.dsn = _ingestion.get_dsn()
+		options.transport_spooling = true
+		options.envelope_compression = SentryOptions.COMPRESSION_NONE
+		options.transport_session_budget_kb = 64
+	)
+
+
+func after() -> void:
+	_ingestion.stop()
+
+
+func _await_request(needle: String) -> Dictionary:
+	var deadline := Time.get_ticks_msec() + 10000
+	while Time.get_ticks_msec() < deadline:
+		_ingestion.serve()
+		var request := _ingestion.find_request(needle)
+		if not request.is_empty():
+			return request
+		await get_tree().process_frame
+	return {}
+
+
+## Attachments should be shed first, so that the event still fits into the budget.
+func test_attachments_shed_first(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	var payload := "attachment-payload ".repeat(10000).to_utf8_buffer()
+	SentrySDK.add_attachment(SentryAttachment.create_with_bytes(payload, "large.txt"))
+	SentrySDK.capture_message("budget-message")
+
+	var request: Dictionary = await _await_request("budget-message")
+	assert_dict(request).is_not_empty()
+	assert_str(request["body"]).not_contains("attachment-payload")
+
+	assert_float(Performance.get_custom_monitor("sentry/transport_attachments_shed")).is_greater_equal(1.0)
+	assert_float(Performance.get_custom_monitor("sentry/transport_bytes_shed")).is_greater_equal(payload.size())
+
+
+## Once the budget is used up, errors should be shed as well.
+func test_envelopes_shed_when_exhausted(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	var shed_before: float = Performance.get_custom_monitor("sentry/transport_envelopes_shed")
+	var padding := "x".repeat(8000)
+	for i in 10:
+		SentrySDK.capture_message("exhausting-message " + padding)
+
+	assert_float(Performance.get_custom_monitor("sentry/transport_envelopes_shed")).is_greater(shed_before)
@@ -0,0 +1,59 @@
+extends GdUnitTestSuite
+## Test envelope compression against a local stand-in for the ingestion endpoint, which decodes the payloads.
+
+
+var _ingestion := MockIngestion.new()
+
+
+func before() -> void:
+	_ingestion.start()
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.dsn = _ingestion.get_dsn()
+		options.transport_spooling = true
+		options.envelope_compression = SentryOptions.COMPRESSION_GZIP
+		options.envelope_compression_threshold = 16384
+	)
+
+
+func after() -> void:
+	_ingestion.stop()
+
+
+func _await_request(needle: String) -> Dictionary:
+	var deadline := Time.get_ticks_msec() + 10000
+	while Time.get_ticks_msec() < deadline:
+		_ingestion.serve()
+		var request := _ingestion.find_request(needle)
+		if not request.is_empty():
+			return request
+		await get_tree().process_frame
+	return {}
+
+
+## Envelopes above the threshold should be sent gzipped, and decode to the original payload.
+func test_large_envelope_compressed(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	var padding := "compressible ".repeat(2000)
+	SentrySDK.capture_message("large-message " + padding)
+
+	var request: Dictionary = await _await_request("large-message")
+	assert_dict(request).is_not_empty()
+	assert_str(request["encoding"]).is_equal("gzip")
+	assert_str(request["body"]).contains(padding)
+
+	# Envelope starts with a JSON header line.
+	var header: Variant = JSON.parse_string(String(request["body"]).get_slice("\n", 0))
+	assert_bool(header is Dictionary and not String(header.get("event_id", "")).is_empty()).is_true()
+
+	assert_float(Performance.get_custom_monitor("sentry/transport_bytes_saved")).is_greater(0.0)
+
+
+## Envelopes below the threshold should be sent as is.
+func test_small_envelope_uncompressed(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	SentrySDK.add_breadcrumb(SentryBreadcrumb.create("tiny"))
+	var feedback := SentryFeedback.new()
+	feedback.message = "small-feedback"
+	SentrySDK.capture_feedback(feedback)
+
+	var request: Dictionary = await _await_request("small-feedback")
+	assert_dict(request).is_not_empty()
+	assert_str(request["encoding"]).is_empty()
@@ -0,0 +1,49 @@
+extends GdUnitTestSuite
+## Test spooling transport against a local stand-in for the ingestion endpoint.
+
+
+var _ingestion := MockIngestion.new()
+
+
+func before() -> void:
+	_ingestion.start()
+	_ingestion.failures_left = 1
+	SentrySDK.init(func(options: SentryOptions) -> void:
+		options.dsn = _ingestion.get_dsn()
+		options.transport_spooling = true
+		options.envelope_compression = SentryOptions.COMPRESSION_NONE
+	)
+
+
+func after() -> void:
+	_ingestion.stop()
+
+
+## Flush should report failure while a captured envelope is still waiting to be uploaded.
+func test_flush_fails_while_pending(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	# Requests are not served until the next test.
+	SentrySDK.capture_message("pending-message")
+	assert_bool(SentrySDK.flush(200)).is_false()
+
+
+## Envelope should be delivered after the transport backs off from a failed upload.
+func test_envelope_delivered_after_retry(_do_skip = not OS.get_name() in ["Windows", "Linux", "macOS"]) -> void:
+	SentrySDK.capture_message("spooled-message")
+
+	var deadline := Time.get_ticks_msec() + 15000
+	while Time.get_ticks_msec() < deadline:
+		_ingestion.serve()
+		if not _ingestion.find_request("spooled-message").is_empty() and Performance.get_custom_monitor("sentry/envelopes_sent") > 0:
+			break
+		await get_tree().process_frame
+
+	var request := _ingestion.find_request("spooled-message")
+	assert_dict(request).is_not_empty()
+	assert_str(request["head"]).starts_with("POST /api/42/envelope/ HTTP/1.1")
+	assert_str(request["head"]).contains("sentry_key=testkey")
+	assert_str(String(request["head"]).to_lower()).contains("content-type: application/x-sentry-envelope")
+	assert_str(request["encoding"]).is_empty()
+
+	assert_float(Performance.get_custom_monitor("sentry/transport_retries")).is_greater_equal(1.0)
+	assert_float(Performance.get_custom_monitor("sentry/envelopes_sent")).is_greater_equal(1.0)
+	assert_float(Performance.get_custom_monitor("sentry/transport_upload_time_ms")).is_greater(0.0)
@@ -17,7 +17,17 @@ func test_bool_properties(property: String, test_parameters := [
 		["attach_log"],
 		["attach_screenshot"],
 		["attach_scene_tree"],
+		["enable_metrics"],
+		["scene_tree_mirror"],
+		["script_profiler"],
+		["trace_scene_changes"],
+		["trace_threaded_loads"],
 		["send_default_pii"],
+		["minimal_crash_handling"],
+		["journal"],
+		["async_init"],
+		["persist_on_shutdown"],
+		["transport_spooling"],
 		["logger_enabled"],
 		["logger_include_source"],
 ]) -> void:
@@ -45,6 +55,20 @@ func test_sample_rate() -> void:
 	assert_float(options.sample_rate).is_equal_approx(0.5, 0.01)
 
 
+## SentryOptions.traces_sample_rate should be set to the specified value.
+func test_traces_sample_rate() -> void:
+	options.traces_sample_rate = 0.25
+	assert_float(options.traces_sample_rate).is_equal_approx(0.25, 0.01)
+
+
+## Sample rates should be clamped to the range of 0.0 to 1.0.
+func test_sample_rates_clamped() -> void:
+	options.sample_rate = 1.5
+	options.traces_sample_rate = -0.5
+	assert_float(options.sample_rate).is_equal(1.0)
+	assert_float(options.traces_sample_rate).is_equal(0.0)
+
+
 ## SentryOptions.max_breadcrumbs should be set to the specified value.
 func test_max_breadcrumbs() -> void:
 	options.max_breadcrumbs = 42
@@ -65,6 +89,61 @@ func test_logger_breadcrumb_mask() -> void:
 	assert_int(options.logger_breadcrumb_mask).is_equal(mask)
 
 
+## Test integer scene tree limit properties.
+@warning_ignore("unused_parameter")
+func test_scene_tree_limit_properties(property: String, test_parameters := [
+		["scene_tree_max_nodes"],
+		["scene_tree_max_depth"],
+		["scene_tree_time_budget_ms"],
+]) -> void:
+	options.set(property, 42)
+	assert_int(options.get(property)).is_equal(42)
+
+
+## Test script profiler properties.
+func test_script_profiler_properties() -> void:
+	options.script_profiler_interval_ms = 42
+	assert_int(options.script_profiler_interval_ms).is_equal(42)
+	options.script_profiler_max_overhead = 2.5
+	assert_float(options.script_profiler_max_overhead).is_equal_approx(2.5, 0.01)
+
+
+## SentryOptions.metrics_flush_interval_sec should be set to the specified value.
+func test_metrics_flush_interval_sec() -> void:
+	options.metrics_flush_interval_sec = 42
+	assert_int(options.metrics_flush_interval_sec).is_equal(42)
+
+
+## Test spooling transport properties.
+func test_transport_properties() -> void:
+	options.transport_queue_size = 42
+	assert_int(options.transport_queue_size).is_equal(42)
+	options.transport_workers = 4
+	assert_int(options.transport_workers).is_equal(4)
+	options.envelope_compression = SentryOptions.COMPRESSION_ZSTD
+	assert_int(options.envelope_compression).is_equal(SentryOptions.COMPRESSION_ZSTD)
+	options.envelope_compression_threshold = 42
+	assert_int(options.envelope_compression_threshold).is_equal(42)
+	options.transport_session_budget_kb = 42
+	assert_int(options.transport_session_budget_kb).is_equal(42)
+	options.transport_hourly_budget_kb = 42
+	assert_int(options.transport_hourly_budget_kb).is_equal(42)
+
+
+## SentryOptions.shutdown_timeout_ms should be set to the specified value, and not go negative.
+func test_shutdown_timeout_ms() -> void:
+	options.shutdown_timeout_ms = 42
+	assert_int(options.shutdown_timeout_ms).is_equal(42)
+	options.shutdown_timeout_ms = -1
+	assert_int(options.shutdown_timeout_ms).is_equal(0)
+
+
+## Test processor time budget property.
+func test_processor_time_budget_ms() -> void:
+	options.processor_time_budget_ms = 42
+	assert_int(options.processor_time_budget_ms).is_equal(42)
+
+
 ## Test integer error logger limit properties.
 @warning_ignore("unused_parameter")
 func test_logger_limit_properties(property: String, test_parameters := [
@@ -17,6 +17,33 @@ func test_capture_message_id() -> void:
 	assert_str(event_id).is_equal(SentrySDK.get_last_event_id())
 
 
+## SentrySDK.get_processing_stats() should include timings of the before_send callback.
+func test_processing_stats() -> void:
+	SentrySDK._set_before_send(func(_ev): return null)
+
+	SentrySDK.capture_message("processing-stats-test")
+
+	var stats: Dictionary = SentrySDK.get_processing_stats()
+	assert_bool(stats.has("before_send")).is_true()
+	var entry: Dictionary = stats["before_send"]
+	assert_int(entry["calls"]).is_greater_equal(1)
+	assert_int(entry["max_usec"]).is_greater_equal(entry["average_usec"])
+
+
+## SDK counters should be registered as Performance custom monitors.
+func test_performance_monitors() -> void:
+	assert_bool(Performance.has_custom_monitor("sentry/events_captured")).is_true()
+	assert_bool(Performance.has_custom_monitor("sentry/process_event_time_ms")).is_true()
+
+	SentrySDK._set_before_send(func(_ev): return null)
+	var dropped_before: float = Performance.get_custom_monitor("sentry/events_dropped_before_send")
+
+	SentrySDK.capture_message("performance-monitors-test")
+
+	var dropped_after: float = Performance.get_custom_monitor("sentry/events_dropped_before_send")
+	assert_float(dropped_after).is_equal(dropped_before + 1.0)
+
+
 ## SentrySDK.set_tag() should assign a tag to the event object.
 func test_set_tag() -> void:
 	SentrySDK._set_before_send(
@@ -58,3 +85,16 @@ func test_variant_conversion_against_stack_overflow() -> void:
 	SentrySDK.set_context("broken_context", dict)
 	# Unset context
 	SentrySDK.set_context("broken_context", {})
+
+
+## SentrySDK.set_thread_label() should accept labels from any thread, including labels exceeding slot capacity.
+func test_set_thread_label() -> void:
+	SentrySDK.set_thread_label("main")
+	SentrySDK.set_thread_label("世界".repeat(100))
+
+	var thread := Thread.new()
+	thread.start(func() -> void:
+		SentrySDK.set_thread_label("test_worker")
+	)
+	thread.wait_to_finish()
+	SentrySDK.set_thread_label("main")
@@ -36,6 +36,29 @@ func test_sentry_user_id_generation() -> void:
 	assert_str(id2).is_not_equal(id1).override_failure_message("Newly-generated ID should be different")
 
 
+## Generated IDs should be valid UUIDv4 strings.
+func test_sentry_user_id_format() -> void:
+	var regex := RegEx.create_from_string("^[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$")
+	var user := SentryUser.new()
+	var seen := {}
+	for i in 1000:
+		user.generate_new_id()
+		assert_object(regex.search(user.id)).override_failure_message("Invalid UUIDv4: " + user.id).is_not_null()
+		seen[user.id] = true
+	assert_int(seen.size()).is_equal(1000)
+
+
+## Benchmark: per-call cost of generating a UUID, including the script call overhead.
+func test_benchmark_generate_new_id(_do_skip = not OS.has_environment("SENTRY_BENCHMARKS")) -> void:
+	const CALLS := 100_000
+	var user := SentryUser.new()
+	var start := Time.get_ticks_usec()
+	for i in CALLS:
+		user.generate_new_id()
+	var elapsed := Time.get_ticks_usec() - start
+	print("SentryUser.generate_new_id(): %.1f ns per call" % [elapsed * 1000.0 / CALLS])
+
+
 func test_default_user_id() -> void:
 	var default1 := SentryUser.create_default()
 	var default2 := SentryUser.create_default()
@@ -176,3 +176,78 @@ func test_advanced_rfc3339_parsing() -> void:
 	timestamp = SentryTimestamp.parse_rfc3339("2021-02-03T04:05:06.987654321Z")
 	assert_object(timestamp).is_not_null()
 	assert_int(timestamp.microseconds_since_unix_epoch).is_equal(1612325106987654)
+
+
+## Fuzz formatting and parsing against Godot's own date conversion.
+func test_rfc3339_fuzz() -> void:
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 3339
+	# From 1900-01-02 to 9999-12-30, so that offsets stay within the supported years.
+	const MIN_SEC := -2208902400
+	const MAX_SEC := 253402214399
+	for i in 5000:
+		var secs := MIN_SEC + int(rng.randf() * (MAX_SEC - MIN_SEC - 86400)) + rng.randi_range(0, 86399)
+		var micros := rng.randi_range(0, 999999)
+		var usec := secs * 1000000 + micros
+		var expected := "%s.%06dZ" % [Time.get_datetime_string_from_unix_time(secs), micros]
+
+		var formatted := SentryTimestamp.from_microseconds_since_unix_epoch(usec).to_rfc3339()
+		assert_str(formatted).is_equal(expected)
+
+		var parsed := SentryTimestamp.parse_rfc3339(formatted)
+		assert_object(parsed).is_not_null()
+		assert_int(parsed.microseconds_since_unix_epoch).is_equal(usec)
+
+		# Same instant with a random offset.
+		var offset_min := rng.randi_range(-12 * 60, 14 * 60)
+		var local := Time.get_datetime_string_from_unix_time(secs + offset_min * 60)
+		var offset := "%s%02d:%02d" % ["+" if offset_min >= 0 else "-", absi(offset_min) / 60, absi(offset_min) % 60]
+		parsed = SentryTimestamp.parse_rfc3339("%s.%06d%s" % [local, micros, offset])
+		assert_object(parsed).is_not_null()
+		assert_int(parsed.microseconds_since_unix_epoch).is_equal(usec)
+
+
+## Test that malformed numeric fields are rejected.
+func test_rfc3339_strict_fields() -> void:
+	assert_object(SentryTimestamp.parse_rfc3339("2021-02-03T 4:05:06Z")).is_null()
+	assert_object(SentryTimestamp.parse_rfc3339("2021-02-03T+4:05:06Z")).is_null()
+	assert_object(SentryTimestamp.parse_rfc3339("2021-02-03T04:05:06.Z")).is_null()
+	assert_object(SentryTimestamp.parse_rfc3339("2021-02-03T04:05:06.1234567890Z")).is_null()
+	assert_object(SentryTimestamp.parse_rfc3339("2021-02-30T04:05:06Z")).is_null()
+	assert_object(SentryTimestamp.parse_rfc3339("2021-02-03T04:05:06+0200")).is_null()
+
+
+## Test that parsing and formatting support the same range of years, 0000 to 9999.
+func test_rfc3339_year_range() -> void:
+	var boundaries := {
+		"0000-01-01T00:00:00.000000Z": -62167219200000000,
+		"1899-12-31T23:59:59.000000Z": -2208988801000000,
+		"9999-12-31T23:59:59.999999Z": 253402300799999999,
+	}
+	for formatted: String in boundaries:
+		var parsed := SentryTimestamp.parse_rfc3339(formatted)
+		assert_object(parsed).is_not_null()
+		assert_int(parsed.microseconds_since_unix_epoch).is_equal(boundaries[formatted])
+		assert_str(parsed.to_rfc3339()).is_equal(formatted)
+
+	# Just outside of the range.
+	assert_str(SentryTimestamp.from_microseconds_since_unix_epoch(-62167219200000001).to_rfc3339()).is_empty()
+	assert_str(SentryTimestamp.from_microseconds_since_unix_epoch(253402300800000000).to_rfc3339()).is_empty()
+
+
+## Benchmark: per-call cost of formatting and parsing, including the script call overhead.
+func test_benchmark_rfc3339(_do_skip = not OS.has_environment("SENTRY_BENCHMARKS")) -> void:
+	const CALLS := 100_000
+	var timestamp := SentryTimestamp.from_microseconds_since_unix_epoch(1612325106123456)
+	var start := Time.get_ticks_usec()
+	for i in CALLS:
+		timestamp.to_rfc3339()
+	var format_usec := Time.get_ticks_usec() - start
+
+	start = Time.get_ticks_usec()
+	for i in CALLS:
+		SentryTimestamp.parse_rfc3339("2021-02-03T04:05:06.123456+02:00")
+	var parse_usec := Time.get_ticks_usec() - start
+
+	print("SentryTimestamp: to_rfc3339() %.1f ns, parse_rfc3339() %.1f ns per call" % [
+			format_usec * 1000.0 / CALLS, parse_usec * 1000.0 / CALLS])
@@ -0,0 +1,27 @@
+extends SentryTestSuite
+## Test transactions and spans API.
+
+
+## With the default traces_sample_rate of 0.0, the same no-op transaction should be returned each time.
+func test_sampled_out_transaction_is_shared() -> void:
+	var first := SentrySDK.start_transaction("test-transaction", "test")
+	var second := SentrySDK.start_transaction("test-transaction", "test")
+	assert_object(first).is_not_null()
+	assert_object(first).is_same(second)
+
+
+## Sampled-out transaction should support the full span API without errors.
+func test_sampled_out_transaction_api() -> void:
+	var transaction := SentrySDK.start_transaction("test-transaction", "test")
+	transaction.set_data("level", "forest")
+
+	var span := transaction.start_child("resource.load", "res://test.tscn")
+	assert_object(span).is_not_null()
+	span.set_data("size", 42)
+
+	var grandchild := span.start_child("resource.parse")
+	assert_object(grandchild).is_not_null()
+
+	grandchild.finish()
+	span.finish()
+	transaction.finish()
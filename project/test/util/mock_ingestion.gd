@@ -0,0 +1,111 @@
+class_name MockIngestion
+extends RefCounted
+## Local stand-in for the Sentry ingestion endpoint, used to test transports.
+##
+## Listens on 127.0.0.1, keeps connections alive like the real endpoint, and records each
+## request with its body decoded according to Content-Encoding. Call serve() regularly
+## (e.g., once per frame) to process incoming data.
+
+
+class Connection:
+	var peer: StreamPeerTCP
+	var buffer := PackedByteArray()
+
+
+## Requests received so far: {"head": String, "encoding": String, "body": String}.
+var requests: Array[Dictionary] = []
+
+## Number of upcoming requests to answer with "503 Service Unavailable".
+var failures_left := 0
+
+var _server := TCPServer.new()
+var _connections: Array[Connection] = []
+
+
+func start() -> void:
+	_server.listen(0, "127.0.0.1")
+
+
+func stop() -> void:
+	for connection in _connections:
+		connection.peer.disconnect_from_host()
+	_server.stop()
+
+
+func get_dsn(project_id: int = 42) -> String:
+	return "http://testkey@127.0.0.1:%d/%d" % [_server.get_local_port(), project_id]
+
+
+## Accepts connections and answers complete requests.
+func serve() -> void:
+	while _server.is_connection_available():
+		var connection := Connection.new()
+		connection.peer = _server.take_connection()
+		_connections.append(connection)
+
+	for connection in _connections:
+		connection.peer.poll()
+		var available := connection.peer.get_available_bytes()
+		if available > 0:
+			connection.buffer.append_array(connection.peer.get_data(available)[1])
+		while _process_request(connection):
+			pass
+
+
+## Returns the first request with body containing the needle, or an empty dictionary.
+func find_request(needle: String) -> Dictionary:
+	for request in requests:
+		if String(request["body"]).contains(needle):
+			return request
+	return {}
+
+
+func _process_request(connection: Connection) -> bool:
+	# Headers are ASCII, so the string index matches the byte offset.
+	var text := connection.buffer.get_string_from_ascii()
+	var header_end := text.find("\r\n\r\n")
+	if header_end < 0:
+		return false
+
+	var head := text.substr(0, header_end)
+	var content_length := 0
+	var encoding := ""
+	for line in head.split("\r\n"):
+		var lower := line.to_lower()
+		if lower.begins_with("content-length:"):
+			content_length = line.get_slice(":", 1).strip_edges().to_int()
+		elif lower.begins_with("content-encoding:"):
+			encoding = line.get_slice(":", 1).strip_edges()
+
+	var body_start := header_end + 4
+	if connection.buffer.size() < body_start + content_length:
+		return false
+	var body := connection.buffer.slice(body_start, body_start + content_length)
+	connection.buffer = connection.buffer.slice(body_start + content_length)
+
+	requests.append({
+		"head": head,
+		"encoding": encoding,
+		"body": _decode(body, encoding).get_string_from_utf8(),
+	})
+
+	var response: String
+	if failures_left > 0:
+		failures_left -= 1
+		response = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n"
+	else:
+		response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 2\r\n\r\n{}"
+	connection.peer.put_data(response.to_utf8_buffer())
+	return true
+
+
+func _decode(body: PackedByteArray, encoding: String) -> PackedByteArray:
+	# Decompressed size is unknown, so an upper bound is passed -- the result is trimmed to the actual size.
+	const MAX_DECOMPRESSED_SIZE := 1 << 24
+	match encoding:
+		"gzip":
+			return body.decompress(MAX_DECOMPRESSED_SIZE, FileAccess.COMPRESSION_GZIP)
+		"zstd":
+			return body.decompress(MAX_DECOMPRESSED_SIZE, FileAccess.COMPRESSION_ZSTD)
+		_:
+			return body
@@ -0,0 +1,58 @@
+extends SentryTransport
+## Transport that keeps envelopes in memory, used to inspect what the SDK sends.
+##
+## Preload it in a test suite:
+##     const RecordingTransport := preload("res://test/util/recording_transport.gd")
+
+
+## True once the SDK has started the transport.
+var started := false
+
+## True once the SDK has asked the transport to flush.
+var flushed := false
+
+## Envelopes received so far, decoded as UTF-8.
+var envelopes: Array[String] = []
+
+var _mutex := Mutex.new()
+
+
+func _startup() -> bool:
+	started = true
+	return true
+
+
+func _send_envelope(envelope: PackedByteArray) -> void:
+	_mutex.lock()
+	envelopes.append(envelope.get_string_from_utf8())
+	_mutex.unlock()
+
+
+func _flush(_timeout_ms: int) -> bool:
+	flushed = true
+	return true
+
+
+## Returns the first envelope containing [param needle], or an empty string.
+func find(needle: String) -> String:
+	_mutex.lock()
+	var found := ""
+	for envelope in envelopes:
+		if envelope.contains(needle):
+			found = envelope
+			break
+	_mutex.unlock()
+	return found
+
+
+## Waits until an envelope containing [param needle] arrives, and returns it.
+## Returns an empty string if none arrives within [param timeout_ms].
+func await_envelope(needle: String, timeout_ms: int = 10000) -> String:
+	var tree := Engine.get_main_loop() as SceneTree
+	var deadline := Time.get_ticks_msec() + timeout_ms
+	while Time.get_ticks_msec() < deadline:
+		var envelope := find(needle)
+		if not envelope.is_empty():
+			return envelope
+		await tree.process_frame
+	return ""
@@ -0,0 +1,141 @@
+#include "sentry_editor_debugger_plugin.h"
+
+#ifdef TOOLS_ENABLED
+
+#include <godot_cpp/classes/editor_debugger_session.hpp>
+#include <godot_cpp/classes/tree.hpp>
+#include <godot_cpp/classes/tree_item.hpp>
+
+namespace {
+
+constexpr int64_t RATE_WINDOW_USEC = 1'000'000;
+
+enum Column {
+	COLUMN_NAME,
+	COLUMN_LAST_FRAME,
+	COLUMN_PEAK_FRAME,
+	COLUMN_PER_SECOND,
+	COLUMN_TOTAL,
+	COLUMN_MAX,
+};
+
+String _format_value(sentry::telemetry::Counter p_counter, double p_value) {
+	if (sentry::telemetry::is_time_counter(p_counter)) {
+		return String::num(p_value / 1000.0, 3); // ms
+	}
+	return String::num(p_value, 1);
+}
+
+} // unnamed namespace
+
+void SentryEditorDebuggerPlugin::_setup_session(int32_t p_session_id) {
+	Ref<EditorDebuggerSession> session = get_session(p_session_id);
+	ERR_FAIL_COND(session.is_null());
+
+	Tree *tree = memnew(Tree);
+	tree->set_name("Sentry");
+	tree->set_columns(COLUMN_MAX);
+	tree->set_column_titles_visible(true);
+	tree->set_column_title(COLUMN_NAME, "SDK Statistic");
+	tree->set_column_title(COLUMN_LAST_FRAME, "Last Frame");
+	tree->set_column_title(COLUMN_PEAK_FRAME, "Peak Frame");
+	tree->set_column_title(COLUMN_PER_SECOND, "Per Second");
+	tree->set_column_title(COLUMN_TOTAL, "Total");
+	tree->set_column_expand(COLUMN_NAME, true);
+	tree->set_hide_root(true);
+	tree->set_select_mode(Tree::SELECT_ROW);
+
+	SessionStats &stats = sessions[p_session_id];
+	stats = SessionStats();
+	stats.tree = tree;
+
+	TreeItem *root = tree->create_item();
+	for (int i = 0; i < sentry::telemetry::COUNTER_MAX; i++) {
+		TreeItem *row = tree->create_item(root);
+		row->set_text(COLUMN_NAME, sentry::telemetry::get_counter_name((sentry::telemetry::Counter)i));
+		for (int column = COLUMN_LAST_FRAME; column < COLUMN_MAX; column++) {
+			row->set_text_alignment(column, HORIZONTAL_ALIGNMENT_RIGHT);
+		}
+		stats.rows[i] = row;
+	}
+	_refresh_tree(stats);
+
+	session->connect("started", callable_mp(this, &SentryEditorDebuggerPlugin::_on_session_started).bind(p_session_id));
+	session->add_session_tab(tree);
+}
+
+bool SentryEditorDebuggerPlugin::_has_capture(const String &p_capture) const {
+	return p_capture == "sentry";
+}
+
+bool SentryEditorDebuggerPlugin::_capture(const String &p_message, const Array &p_data, int32_t p_session_id) {
+	if (p_message != sentry::telemetry::DEBUGGER_MESSAGE) {
+		return false;
+	}
+
+	SessionStats *stats = sessions.getptr(p_session_id);
+	ERR_FAIL_NULL_V(stats, false);
+	ERR_FAIL_COND_V(p_data.size() != 1 + sentry::telemetry::COUNTER_MAX, false);
+
+	Values &values = stats->values;
+	int64_t ticks_usec = p_data[0];
+	for (int i = 0; i < sentry::telemetry::COUNTER_MAX; i++) {
+		if (sentry::telemetry::is_gauge((sentry::telemetry::Counter)i)) {
+			// Current value rather than a delta.
+			int64_t value = p_data[1 + i];
+			values.last_frame[i] = value;
+			values.peak_frame[i] = MAX(values.peak_frame[i], value);
+			continue;
+		}
+		int64_t delta = p_data[1 + i];
+		values.last_frame[i] = delta;
+		values.peak_frame[i] = MAX(values.peak_frame[i], delta);
+		values.totals[i] += delta;
+		values.window_values[i] += delta;
+	}
+
+	if (values.window_start_usec == 0) {
+		values.window_start_usec = ticks_usec;
+	}
+
+	// The tree is refreshed once per rate window, to keep the editor responsive.
+	int64_t elapsed_usec = ticks_usec - values.window_start_usec;
+	if (elapsed_usec >= RATE_WINDOW_USEC) {
+		for (int i = 0; i < sentry::telemetry::COUNTER_MAX; i++) {
+			values.per_second[i] = values.window_values[i] * 1'000'000.0 / elapsed_usec;
+			values.window_values[i] = 0;
+		}
+		values.window_start_usec = ticks_usec;
+		_refresh_tree(*stats);
+	}
+
+	return true;
+}
+
+void SentryEditorDebuggerPlugin::_on_session_started(int32_t p_session_id) {
+	SessionStats *stats = sessions.getptr(p_session_id);
+	ERR_FAIL_NULL(stats);
+
+	stats->values = Values();
+	_refresh_tree(*stats);
+}
+
+void SentryEditorDebuggerPlugin::_refresh_tree(SessionStats &p_stats) {
+	const Values &values = p_stats.values;
+	for (int i = 0; i < sentry::telemetry::COUNTER_MAX; i++) {
+		sentry::telemetry::Counter counter = (sentry::telemetry::Counter)i;
+		TreeItem *row = p_stats.rows[i];
+		row->set_text(COLUMN_LAST_FRAME, _format_value(counter, values.last_frame[i]));
+		row->set_text(COLUMN_PEAK_FRAME, _format_value(counter, values.peak_frame[i]));
+		if (sentry::telemetry::is_gauge(counter)) {
+			// Rates and totals don't apply to levels.
+			row->set_text(COLUMN_PER_SECOND, "-");
+			row->set_text(COLUMN_TOTAL, "-");
+			continue;
+		}
+		row->set_text(COLUMN_PER_SECOND, _format_value(counter, values.per_second[i]));
+		row->set_text(COLUMN_TOTAL, _format_value(counter, values.totals[i]));
+	}
+}
+
+#endif // TOOLS_ENABLED
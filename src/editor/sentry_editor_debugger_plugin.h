@@ -0,0 +1,54 @@
+#pragma once
+
+#ifdef TOOLS_ENABLED
+
+#include "sentry/telemetry.h"
+
+#include <godot_cpp/classes/editor_debugger_plugin.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+
+namespace godot {
+class Tree;
+class TreeItem;
+} //namespace godot
+
+using namespace godot;
+
+// Adds "Sentry" tab to the debugger, showing SDK overhead reported by the running project
+// (see sentry::telemetry::start_debugger_stream()).
+class SentryEditorDebuggerPlugin : public EditorDebuggerPlugin {
+	GDCLASS(SentryEditorDebuggerPlugin, EditorDebuggerPlugin);
+
+private:
+	struct Values {
+		int64_t last_frame[sentry::telemetry::COUNTER_MAX] = {};
+		int64_t peak_frame[sentry::telemetry::COUNTER_MAX] = {};
+		int64_t totals[sentry::telemetry::COUNTER_MAX] = {};
+
+		// Per-second rates are computed over windows of at least one second.
+		int64_t window_start_usec = 0;
+		int64_t window_values[sentry::telemetry::COUNTER_MAX] = {};
+		double per_second[sentry::telemetry::COUNTER_MAX] = {};
+	};
+
+	struct SessionStats {
+		Tree *tree = nullptr;
+		TreeItem *rows[sentry::telemetry::COUNTER_MAX] = {};
+		Values values;
+	};
+
+	HashMap<int32_t, SessionStats> sessions;
+
+	void _on_session_started(int32_t p_session_id);
+	void _refresh_tree(SessionStats &p_stats);
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	virtual void _setup_session(int32_t p_session_id) override;
+	virtual bool _has_capture(const String &p_capture) const override;
+	virtual bool _capture(const String &p_message, const Array &p_data, int32_t p_session_id) override;
+};
+
+#endif // TOOLS_ENABLED
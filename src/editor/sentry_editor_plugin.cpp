@@ -2,6 +2,7 @@
 
 #ifdef TOOLS_ENABLED
 
+#include "editor/sentry_editor_debugger_plugin.h"
 #include "editor/sentry_editor_export_plugin_android.h"
 #include "editor/sentry_editor_export_plugin_unix.h"
 #include "editor/sentry_editor_export_plugin_web.h"
@@ -28,6 +29,11 @@ void SentryEditorPlugin::_notification(int p_what) {
 				web_export_plugin = Ref(memnew(SentryEditorExportPluginWeb));
 			}
 			add_export_plugin(web_export_plugin);
+
+			if (debugger_plugin.is_null()) {
+				debugger_plugin = Ref(memnew(SentryEditorDebuggerPlugin));
+			}
+			add_debugger_plugin(debugger_plugin);
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
@@ -47,6 +53,11 @@ void SentryEditorPlugin::_notification(int p_what) {
 				remove_export_plugin(web_export_plugin);
 				web_export_plugin.unref();
 			}
+
+			if (debugger_plugin.is_valid()) {
+				remove_debugger_plugin(debugger_plugin);
+				debugger_plugin.unref();
+			}
 		} break;
 	}
 }
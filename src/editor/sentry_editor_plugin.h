@@ -3,6 +3,7 @@
 
 #ifdef TOOLS_ENABLED
 
+#include <godot_cpp/classes/editor_debugger_plugin.hpp>
 #include <godot_cpp/classes/editor_export_plugin.hpp>
 #include <godot_cpp/classes/editor_plugin.hpp>
 
@@ -15,6 +16,7 @@ private:
 	Ref<EditorExportPlugin> android_export_plugin;
 	Ref<EditorExportPlugin> unix_export_plugin;
 	Ref<EditorExportPlugin> web_export_plugin;
+	Ref<EditorDebuggerPlugin> debugger_plugin;
 
 protected:
 	static void _bind_methods() {}
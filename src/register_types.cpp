@@ -1,5 +1,7 @@
 #include "editor/sentry_editor_plugin.h"
+#include "sentry/auto_tracing.h"
 #include "sentry/disabled/disabled_event.h"
+#include "sentry/disabled/disabled_transaction.h"
 #include "sentry/logging/sentry_godot_logger.h"
 #include "sentry/processing/screenshot_processor.h"
 #include "sentry/processing/sentry_event_processor.h"
@@ -9,10 +11,15 @@
 #include "sentry/sentry_breadcrumb.h"
 #include "sentry/sentry_event.h"
 #include "sentry/sentry_feedback.h"
+#include "sentry/sentry_file_transport.h"
 #include "sentry/sentry_log.h"
 #include "sentry/sentry_logger.h"
+#include "sentry/sentry_metrics.h"
 #include "sentry/sentry_options.h"
 #include "sentry/sentry_sdk.h"
+#include "sentry/sentry_span.h"
+#include "sentry/sentry_transaction.h"
+#include "sentry/sentry_transport.h"
 #include "sentry/sentry_user.h"
 
 #include <godot_cpp/classes/engine.hpp>
@@ -23,6 +30,7 @@
 #include "sentry/native/native_breadcrumb.h"
 #include "sentry/native/native_event.h"
 #include "sentry/native/native_log.h"
+#include "sentry/native/native_transaction.h"
 #endif // SDK_NATIVE
 
 #ifdef SDK_ANDROID
@@ -46,6 +54,7 @@
 #endif
 
 #ifdef TOOLS_ENABLED
+#include "editor/sentry_editor_debugger_plugin.h"
 #include "editor/sentry_editor_export_plugin_android.h"
 #include "editor/sentry_editor_export_plugin_unix.h"
 #include "editor/sentry_editor_export_plugin_web.h"
@@ -59,27 +68,36 @@ using namespace sentry;
 void register_runtime_classes() {
 	GDREGISTER_CLASS(SentryLoggerLimits);
 	GDREGISTER_CLASS(SentryExperimental);
+	GDREGISTER_CLASS(SentryTransport);
+	GDREGISTER_CLASS(SentryFileTransport);
 	GDREGISTER_CLASS(SentryOptions);
 	GDREGISTER_INTERNAL_CLASS(RuntimeConfig);
 	GDREGISTER_CLASS(SentryUser);
 	GDREGISTER_CLASS(SentryTimestamp);
 	GDREGISTER_CLASS(SentryLogger);
+	GDREGISTER_CLASS(SentryMetrics);
 	GDREGISTER_CLASS(SentryFeedback);
 	GDREGISTER_CLASS(SentrySDK);
 	GDREGISTER_ABSTRACT_CLASS(SentryAttachment);
 	GDREGISTER_ABSTRACT_CLASS(SentryEvent);
 	GDREGISTER_ABSTRACT_CLASS(SentryBreadcrumb);
 	GDREGISTER_ABSTRACT_CLASS(SentryLog);
+	GDREGISTER_ABSTRACT_CLASS(SentrySpan);
+	GDREGISTER_ABSTRACT_CLASS(SentryTransaction);
 	GDREGISTER_INTERNAL_CLASS(DisabledEvent);
+	GDREGISTER_INTERNAL_CLASS(DisabledTransaction);
 	GDREGISTER_INTERNAL_CLASS(SentryEventProcessor);
 	GDREGISTER_INTERNAL_CLASS(ScreenshotProcessor);
 	GDREGISTER_INTERNAL_CLASS(ViewHierarchyProcessor);
 	GDREGISTER_INTERNAL_CLASS(logging::SentryGodotLogger);
+	GDREGISTER_INTERNAL_CLASS(ResourceLoadTracer);
 
 #ifdef SDK_NATIVE
 	GDREGISTER_INTERNAL_CLASS(native::NativeEvent);
 	GDREGISTER_INTERNAL_CLASS(native::NativeBreadcrumb);
 	GDREGISTER_INTERNAL_CLASS(native::NativeLog);
+	GDREGISTER_INTERNAL_CLASS(native::NativeSpan);
+	GDREGISTER_INTERNAL_CLASS(native::NativeTransaction);
 #endif
 
 #ifdef SDK_ANDROID
@@ -107,6 +125,7 @@ void register_runtime_classes() {
 
 void register_editor_classes() {
 #ifdef TOOLS_ENABLED
+	GDREGISTER_INTERNAL_CLASS(SentryEditorDebuggerPlugin);
 	GDREGISTER_INTERNAL_CLASS(SentryEditorExportPluginAndroid);
 	GDREGISTER_INTERNAL_CLASS(SentryEditorExportPluginWeb);
 	GDREGISTER_INTERNAL_CLASS(SentryEditorPlugin);
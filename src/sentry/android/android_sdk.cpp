@@ -7,8 +7,10 @@
 #include "android_util.h"
 #include "sentry/common_defs.h"
 #include "sentry/logging/print.h"
+#include "sentry/options_snapshot.h"
 #include "sentry/processing/process_event.h"
 #include "sentry/processing/process_log.h"
+#include "sentry/sampling.h"
 #include "sentry/sentry_attachment.h"
 #include "sentry/sentry_sdk.h"
 
@@ -38,6 +40,11 @@ void SentryAndroidBeforeSendHandler::_initialize(Object *p_android_plugin) {
 void SentryAndroidBeforeSendHandler::_before_send(int32_t p_event_handle) {
 	sentry::logging::print_debug("handling before_send: ", p_event_handle);
 
+	if (!sentry::sampling::is_capture_sampled() && !sentry::sampling::sample_event()) {
+		android_plugin->call(ANDROID_SN(releaseEvent), p_event_handle);
+		return;
+	}
+
 	Ref<AndroidEvent> event_obj = memnew(AndroidEvent(android_plugin, p_event_handle));
 	event_obj->set_as_borrowed();
 
@@ -233,6 +240,7 @@ void AndroidSDK::init(const PackedStringArray &p_global_attachments, const Calla
 
 	if (p_configuration_callback.is_valid()) {
 		p_configuration_callback.call(SENTRY_OPTIONS());
+		sentry::options_snapshot::publish(SENTRY_OPTIONS().ptr());
 	}
 
 	for (const String &path : p_global_attachments) {
@@ -250,7 +258,9 @@ void AndroidSDK::init(const PackedStringArray &p_global_attachments, const Calla
 	optionsData["release"] = SENTRY_OPTIONS()->get_release();
 	optionsData["dist"] = SENTRY_OPTIONS()->get_dist();
 	optionsData["environment"] = SENTRY_OPTIONS()->get_environment();
-	optionsData["sample_rate"] = SENTRY_OPTIONS()->get_sample_rate();
+	// Events captured via SentrySDK are sampled before they are built (see sampling.h).
+	// Events that originate in sentry-android are sampled in before_send.
+	optionsData["sample_rate"] = 1.0;
 	optionsData["max_breadcrumbs"] = SENTRY_OPTIONS()->get_max_breadcrumbs();
 	optionsData["enable_logs"] = SENTRY_OPTIONS()->get_enable_logs();
 	optionsData["app_hang_tracking"] = SENTRY_OPTIONS()->is_app_hang_tracking_enabled();
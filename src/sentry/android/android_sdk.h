@@ -47,6 +47,9 @@ private:
 	_FORCE_INLINE_ Object *_get_android_plugin() const { return ObjectDB::get_instance(android_plugin_instance_id); }
 
 public:
+	// NOTE: Attachments are passed to the Android plugin by file path.
+	virtual BitField<Capabilities> get_capabilities() const override { return SUPPORTS_ALL & ~(SUPPORTS_EVENT_ATTACHMENTS | SUPPORTS_EVENT_VIEW_HIERARCHY); }
+
 	virtual void set_context(const String &p_key, const Dictionary &p_value) override;
 	virtual void remove_context(const String &p_key) override;
 
@@ -0,0 +1,301 @@
+#include "auto_tracing.h"
+
+#include "sentry/logging/print.h"
+#include "sentry/options_snapshot.h"
+#include "sentry/sampling.h"
+#include "sentry/sentry_sdk.h"
+
+#include <atomic>
+#include <chrono>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <mutex>
+
+namespace {
+
+std::atomic<bool> trace_scenes{ false };
+std::atomic<bool> trace_loads{ false };
+
+Ref<sentry::ResourceLoadTracer> load_tracer;
+
+// Scene changes -- main thread only.
+struct SceneLoad {
+	String path;
+	int64_t start_usec = 0;
+	uint64_t frame = 0;
+};
+SceneLoad last_scene_load;
+String watched_scene_path;
+ObjectID watched_scene_id;
+int64_t scene_exit_usec = 0;
+uint64_t scene_exit_frame = 0;
+
+// Threaded loads in progress, keyed by path.
+std::mutex pending_mutex;
+HashMap<String, Ref<sentry::SentryTransaction>> pending_loads;
+std::atomic<int> pending_count{ 0 };
+
+_FORCE_INLINE_ bool _is_main_thread() {
+	return OS::get_singleton()->get_thread_caller_id() == OS::get_singleton()->get_main_thread_id();
+}
+
+int64_t _now_usec() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::system_clock::now().time_since_epoch())
+			.count();
+}
+
+_FORCE_INLINE_ bool _sample_trace() {
+	return sentry::sampling::sample(sentry::options_snapshot::get()->traces_sample_rate);
+}
+
+void _on_scene_exiting() {
+	scene_exit_usec = _now_usec();
+	scene_exit_frame = Engine::get_singleton()->get_process_frames();
+	watched_scene_id = ObjectID();
+}
+
+void _watch_current_scene() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Node *scene = scene_tree ? scene_tree->get_current_scene() : nullptr;
+	if (scene == nullptr) {
+		watched_scene_path = String();
+		return;
+	}
+	watched_scene_path = scene->get_scene_file_path();
+	watched_scene_id = scene->get_instance_id();
+	scene->connect("tree_exiting", callable_mp_static(&_on_scene_exiting), Object::CONNECT_ONE_SHOT);
+}
+
+void _unwatch_scene() {
+	Object *scene = ObjectDB::get_instance(watched_scene_id);
+	Callable callable = callable_mp_static(&_on_scene_exiting);
+	if (scene && scene->is_connected("tree_exiting", callable)) {
+		scene->disconnect("tree_exiting", callable);
+	}
+	watched_scene_id = ObjectID();
+}
+
+// Reports a transaction covering the scene change: from the start of loading the new scene
+// (if it was loaded in the same frame) or from the exit of the previous scene, until the new
+// scene is ready.
+void _on_scene_changed() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Node *scene = scene_tree ? scene_tree->get_current_scene() : nullptr;
+	String path = scene ? scene->get_scene_file_path() : String();
+	String previous_path = watched_scene_path;
+
+	int64_t now = _now_usec();
+	uint64_t frame = Engine::get_singleton()->get_process_frames();
+
+	// Only consider marks left in this or the previous frame, as older ones are unrelated.
+	int64_t exit_usec = scene_exit_usec > 0 && frame - scene_exit_frame <= 1 ? scene_exit_usec : 0;
+	int64_t load_usec = last_scene_load.start_usec > 0 && last_scene_load.path == path && frame - last_scene_load.frame <= 1
+			? last_scene_load.start_usec
+			: 0;
+
+	scene_exit_usec = 0;
+	last_scene_load = SceneLoad();
+	_watch_current_scene();
+
+	if (path.is_empty() || (exit_usec == 0 && load_usec == 0) || !_sample_trace()) {
+		return;
+	}
+
+	int64_t start_usec = load_usec > 0 ? load_usec : exit_usec;
+	Ref<sentry::SentryTransaction> transaction = INTERNAL_SDK()->start_transaction(path, "scene.change", start_usec);
+	if (transaction.is_null()) {
+		return;
+	}
+	if (!previous_path.is_empty()) {
+		transaction->set_data("scene.previous", previous_path);
+	}
+	if (load_usec > 0 && exit_usec >= load_usec) {
+		// Loading and instantiating the new scene happen before the previous scene exits.
+		transaction->set_data("scene.load_ms", (exit_usec - load_usec) / 1000.0);
+	}
+	if (exit_usec > 0) {
+		transaction->set_data("scene.enter_ms", (now - exit_usec) / 1000.0);
+	}
+	transaction->finish();
+}
+
+int64_t _get_file_size(const String &p_path) {
+	if (!FileAccess::file_exists(p_path)) {
+		return -1;
+	}
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+	return file.is_valid() ? (int64_t)file->get_length() : -1;
+}
+
+// Finishes transactions of threaded loads that are no longer in progress.
+// NOTE: Completion is only noticed once per frame, so durations are rounded up to the frame.
+void _poll_threaded_loads() {
+	LocalVector<String> paths;
+	{
+		std::lock_guard lock(pending_mutex);
+		for (const KeyValue<String, Ref<sentry::SentryTransaction>> &kv : pending_loads) {
+			paths.push_back(kv.key);
+		}
+	}
+
+	for (const String &path : paths) {
+		ResourceLoader::ThreadLoadStatus status = ResourceLoader::get_singleton()->load_threaded_get_status(path);
+		if (status == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+			continue;
+		}
+
+		Ref<sentry::SentryTransaction> transaction;
+		{
+			std::lock_guard lock(pending_mutex);
+			transaction = pending_loads[path];
+			pending_loads.erase(path);
+			pending_count.store(pending_loads.size(), std::memory_order_relaxed);
+		}
+
+		// The status is invalid if the result has already been collected with load_threaded_get().
+		Ref<Resource> resource = ResourceLoader::get_singleton()->get_cached_ref(path);
+		bool loaded = status == ResourceLoader::THREAD_LOAD_LOADED || (status == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE && resource.is_valid());
+		transaction->set_data("resource.status", loaded ? "loaded" : "failed");
+		if (resource.is_valid()) {
+			transaction->set_data("resource.type", resource->get_class());
+		}
+		int64_t size = _get_file_size(path);
+		if (size >= 0) {
+			transaction->set_data("resource.size", size);
+		}
+		transaction->finish();
+	}
+}
+
+void _on_process_frame() {
+	if (pending_count.load(std::memory_order_relaxed) > 0) {
+		_poll_threaded_loads();
+	}
+}
+
+void _connect_scene_tree() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to start automatic tracing - expected SceneTree instance as main loop.");
+
+	if (trace_scenes) {
+		Callable on_scene_changed = callable_mp_static(&_on_scene_changed);
+		if (!scene_tree->is_connected("scene_changed", on_scene_changed)) {
+			scene_tree->connect("scene_changed", on_scene_changed);
+		}
+		_watch_current_scene();
+	}
+
+	if (trace_loads) {
+		Callable on_process_frame = callable_mp_static(&_on_process_frame);
+		if (!scene_tree->is_connected("process_frame", on_process_frame)) {
+			scene_tree->connect("process_frame", on_process_frame);
+		}
+	}
+}
+
+} // unnamed namespace
+
+namespace sentry {
+
+bool ResourceLoadTracer::_recognize_path(const String &p_path, const StringName &p_type) const {
+	if (_is_main_thread()) {
+		return trace_scenes && (p_path.ends_with(".tscn") || p_path.ends_with(".scn"));
+	}
+	if (!trace_loads) {
+		return false;
+	}
+	// Only loads requested with load_threaded_request() are of interest, not their dependencies.
+	// Scenes converted to binary on export are loaded from a remapped path, so those are checked
+	// by their original path in _load().
+	return p_path.begins_with("res://.godot/exported/") ||
+			ResourceLoader::get_singleton()->load_threaded_get_status(p_path) == ResourceLoader::THREAD_LOAD_IN_PROGRESS;
+}
+
+Variant ResourceLoadTracer::_load(const String &p_path, const String &p_original_path, bool p_use_sub_threads, int32_t p_cache_mode) const {
+	if (_is_main_thread()) {
+		// Possibly a scene about to be changed to -- checked in _on_scene_changed().
+		last_scene_load.path = p_original_path;
+		last_scene_load.start_usec = _now_usec();
+		last_scene_load.frame = Engine::get_singleton()->get_process_frames();
+	} else if (_sample_trace() &&
+			ResourceLoader::get_singleton()->load_threaded_get_status(p_original_path) == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+		// Requested with load_threaded_request() -- dependencies loaded along with it are not reported.
+		std::lock_guard lock(pending_mutex);
+		if (!pending_loads.has(p_original_path)) {
+			Ref<SentryTransaction> transaction = INTERNAL_SDK()->start_transaction(p_original_path, "resource.load");
+			if (transaction.is_valid()) {
+				pending_loads[p_original_path] = transaction;
+				pending_count.store(pending_loads.size(), std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Let the next loader load it.
+	return ERR_FILE_UNRECOGNIZED;
+}
+
+} //namespace sentry
+
+namespace sentry::auto_tracing {
+
+void start() {
+	trace_scenes = SENTRY_OPTIONS()->is_trace_scene_changes_enabled();
+	trace_loads = SENTRY_OPTIONS()->is_trace_threaded_loads_enabled();
+
+	if (SENTRY_OPTIONS()->get_traces_sample_rate() <= 0.0 || (!trace_scenes && !trace_loads)) {
+		trace_scenes = false;
+		trace_loads = false;
+		return;
+	}
+
+	sentry::logging::print_debug("Starting automatic tracing");
+
+	if (load_tracer.is_null()) {
+		load_tracer.instantiate();
+	}
+	ResourceLoader::get_singleton()->add_resource_format_loader(load_tracer, true);
+
+	if (Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop())) {
+		_connect_scene_tree();
+	} else {
+		// SceneTree is not available during early initialization.
+		callable_mp_static(&_connect_scene_tree).call_deferred();
+	}
+}
+
+void stop() {
+	trace_scenes = false;
+	trace_loads = false;
+
+	if (load_tracer.is_valid()) {
+		ResourceLoader::get_singleton()->remove_resource_format_loader(load_tracer);
+		load_tracer.unref();
+	}
+
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	if (scene_tree) {
+		Callable on_scene_changed = callable_mp_static(&_on_scene_changed);
+		if (scene_tree->is_connected("scene_changed", on_scene_changed)) {
+			scene_tree->disconnect("scene_changed", on_scene_changed);
+		}
+		Callable on_process_frame = callable_mp_static(&_on_process_frame);
+		if (scene_tree->is_connected("process_frame", on_process_frame)) {
+			scene_tree->disconnect("process_frame", on_process_frame);
+		}
+	}
+	_unwatch_scene();
+
+	// Unfinished transactions are released, and reported as cancelled.
+	std::lock_guard lock(pending_mutex);
+	pending_loads.clear();
+	pending_count.store(0, std::memory_order_relaxed);
+}
+
+} //namespace sentry::auto_tracing
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <godot_cpp/classes/resource_format_loader.hpp>
+
+using namespace godot;
+
+namespace sentry {
+
+// Observes resource loads for automatic tracing. It's placed in front of other loaders, but never
+// loads anything itself: it takes note of the load and lets the next loader in line handle it.
+class ResourceLoadTracer : public ResourceFormatLoader {
+	GDCLASS(ResourceLoadTracer, ResourceFormatLoader);
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	virtual PackedStringArray _get_recognized_extensions() const override { return PackedStringArray(); }
+	virtual bool _handles_type(const StringName &p_type) const override { return false; }
+	virtual bool _recognize_path(const String &p_path, const StringName &p_type) const override;
+	virtual Variant _load(const String &p_path, const String &p_original_path, bool p_use_sub_threads, int32_t p_cache_mode) const override;
+};
+
+} //namespace sentry
+
+// Automatic transactions for scene changes and threaded resource loads
+// (see SentryOptions.trace_scene_changes and SentryOptions.trace_threaded_loads).
+namespace sentry::auto_tracing {
+
+// Must be called on the main thread.
+void start();
+void stop();
+
+} //namespace sentry::auto_tracing
@@ -16,6 +16,9 @@ private:
 	Ref<Mutex> last_event_id_mutex;
 
 public:
+	// NOTE: Attachments are added to Cocoa scope by file path.
+	virtual BitField<Capabilities> get_capabilities() const override { return SUPPORTS_ALL & ~(SUPPORTS_EVENT_ATTACHMENTS | SUPPORTS_EVENT_VIEW_HIERARCHY); }
+
 	virtual void set_context(const String &p_key, const Dictionary &p_value) override;
 	virtual void remove_context(const String &p_key) override;
 
@@ -41,6 +44,8 @@ public:
 	virtual void add_attachment(const Ref<SentryAttachment> &p_attachment) override;
 
 	virtual void init(const PackedStringArray &p_global_attachments, const Callable &p_configuration_callback) override;
+	virtual bool flush(int p_timeout_ms) override;
+
 	virtual void close() override;
 	virtual bool is_enabled() const override;
 
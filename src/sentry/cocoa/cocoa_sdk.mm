@@ -7,11 +7,14 @@
 #include "cocoa_util.h"
 #include "sentry/common_defs.h"
 #include "sentry/logging/print.h"
+#include "sentry/options_snapshot.h"
 #include "sentry/processing/process_event.h"
 #include "sentry/processing/process_log.h"
+#include "sentry/sampling.h"
 #include "sentry/sentry_attachment.h"
 #include "sentry/sentry_sdk.h"
 
+#include <chrono>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/core/mutex_lock.hpp>
@@ -241,13 +244,16 @@ void CocoaSDK::init(const PackedStringArray &p_global_attachments, const Callabl
 	[objc::SentrySDK startWithConfigureOptions:^(objc::SentryOptions *options) {
 		if (p_configuration_callback.is_valid()) {
 			p_configuration_callback.call(SENTRY_OPTIONS());
+			sentry::options_snapshot::publish(SENTRY_OPTIONS().ptr());
 		}
 
 		options.dsn = string_to_objc(SENTRY_OPTIONS()->get_dsn());
 		options.debug = SENTRY_OPTIONS()->is_debug_enabled();
 		options.releaseName = string_to_objc(SENTRY_OPTIONS()->get_release());
 		options.environment = string_to_objc(SENTRY_OPTIONS()->get_environment());
-		options.sampleRate = double_to_objc(SENTRY_OPTIONS()->get_sample_rate());
+		// Events captured via SentrySDK are sampled before they are built (see sampling.h).
+		// Events that originate in sentry-cocoa are sampled in beforeSend.
+		options.sampleRate = double_to_objc(1.0);
 		options.maxBreadcrumbs = (NSUInteger)SENTRY_OPTIONS()->get_max_breadcrumbs();
 		options.sendDefaultPii = SENTRY_OPTIONS()->is_send_default_pii_enabled();
 		options.diagnosticLevel = sentry_level_to_objc(SENTRY_OPTIONS()->get_diagnostic_level());
@@ -260,6 +266,11 @@ void CocoaSDK::init(const PackedStringArray &p_global_attachments, const Callabl
 		options.enableAppHangTracking = SENTRY_OPTIONS()->is_app_hang_tracking_enabled();
 		options.appHangTimeoutInterval = SENTRY_OPTIONS()->get_app_hang_timeout_sec();
 
+		// Envelopes are stored on disk before they are sent, so the ones left are sent on the next launch.
+		options.shutdownTimeInterval = SENTRY_OPTIONS()->is_persist_on_shutdown_enabled()
+				? 0.0
+				: SENTRY_OPTIONS()->get_shutdown_timeout_ms() / 1000.0;
+
 		// NOTE: This only works for captureMessage(), unfortunately.
 		options.attachStacktrace = false;
 
@@ -295,6 +306,10 @@ void CocoaSDK::init(const PackedStringArray &p_global_attachments, const Callabl
 		};
 
 		options.beforeSend = ^objc::SentryEvent *(objc::SentryEvent *event) {
+			if (!sentry::sampling::is_capture_sampled() && !sentry::sampling::sample_event()) {
+				return nil;
+			}
+
 			Ref<CocoaEvent> event_obj = memnew(CocoaEvent(event));
 			Ref<CocoaEvent> processed = sentry::process_event(event_obj);
 
@@ -326,6 +341,15 @@ void CocoaSDK::init(const PackedStringArray &p_global_attachments, const Callabl
 	}
 }
 
+bool CocoaSDK::flush(int p_timeout_ms) {
+	// Cocoa SDK doesn't report whether flushing completed, but it returns early only once
+	// everything is sent. Running into the timeout is reported as a failure.
+	auto start = std::chrono::steady_clock::now();
+	[objc::SentrySDK flush:p_timeout_ms / 1000.0];
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed < std::chrono::milliseconds(p_timeout_ms);
+}
+
 void CocoaSDK::close() {
 	[objc::SentrySDK close];
 }
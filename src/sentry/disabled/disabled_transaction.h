@@ -0,0 +1,26 @@
+#pragma once
+
+#include "sentry/sentry_transaction.h"
+
+namespace sentry {
+
+// Transaction that records nothing. A single instance is shared by all callers, and it is also
+// returned as its own child span, so that no allocations happen when tracing is off.
+class DisabledTransaction : public SentryTransaction {
+	GDCLASS(DisabledTransaction, SentryTransaction);
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	virtual Ref<SentrySpan> start_child(const String &p_operation, const String &p_description = "") override { return Ref<SentrySpan>(this); }
+
+	virtual void set_data(const String &p_key, const Variant &p_value) override {}
+
+	virtual void finish() override {}
+	virtual bool is_finished() const override { return false; }
+
+	virtual String get_name() const override { return String(); }
+};
+
+} // namespace sentry
@@ -7,6 +7,7 @@
 #include "sentry/sentry_breadcrumb.h"
 #include "sentry/sentry_event.h"
 #include "sentry/sentry_feedback.h"
+#include "sentry/sentry_transaction.h"
 #include "sentry/sentry_user.h"
 
 #include <godot_cpp/variant/dictionary.hpp>
@@ -21,8 +22,12 @@ class InternalSDK {
 public:
 	enum Capabilities : int64_t {
 		SUPPORTS_EARLY_INIT = (1LL << 0),
-		// SUPPORTS_RUNNING_DOOM = (1LL << 1),
-		// SUPPORTS_LANDING_ON_THE_MOON = (1LL << 2)
+		// Backend accepts in-memory attachments produced for a single event (see SentryEvent::add_attachment()).
+		SUPPORTS_EVENT_ATTACHMENTS = (1LL << 1),
+		// Backend can deliver view hierarchy as an in-memory event attachment.
+		SUPPORTS_EVENT_VIEW_HIERARCHY = (1LL << 2),
+		// SUPPORTS_RUNNING_DOOM = (1LL << 3),
+		// SUPPORTS_LANDING_ON_THE_MOON = (1LL << 4)
 		SUPPORTS_ALL = ~0LL
 	};
 
@@ -53,6 +58,13 @@ public:
 
 	virtual void add_attachment(const Ref<SentryAttachment> &p_attachment) = 0;
 
+	// Starts a transaction that is already sampled in. Returns null if the backend doesn't support tracing.
+	// Start timestamp is in microseconds since Unix epoch, or zero to start it now.
+	virtual Ref<SentryTransaction> start_transaction(const String &p_name, const String &p_operation, int64_t p_start_timestamp_usec = 0) { return Ref<SentryTransaction>(); }
+
+	// Waits until captured envelopes are sent, up to the timeout. Returns false on timeout, or if the backend doesn't support it.
+	virtual bool flush(int p_timeout_ms) { return false; }
+
 	virtual void init(const PackedStringArray &p_global_attachments, const Callable &p_configuration_callback) = 0;
 	virtual void close() = 0;
 	virtual bool is_enabled() const = 0;
@@ -40,6 +40,10 @@ interface AttachmentData {
   attachmentType?: string;
 }
 
+// Event hint data key marking events that were captured through the SDK API,
+// and therefore already sampled in the C++ layer.
+const CAPTURE_SAMPLED_HINT = "godot_capture_sampled";
+
 // *** Utility Functions
 
 function safeParseJSON<T = any>(json: string, fallback: T): T {
@@ -123,7 +127,11 @@ class SentryBridge {
         // NOTE: Populated during processing in C++ layer
         const outAttachments: Array<AttachmentData> = [];
 
+        // Events captured through the SDK API were already sampled in the C++ layer.
+        (event as any).captureSampled = hint.data?.[CAPTURE_SAMPLED_HINT] === true;
+
         beforeSendCallback(event, outAttachments);
+        delete (event as any).captureSampled;
 
         // Add attachments loaded from the C++ layer during event processing
         if (!hint.attachments) {
@@ -243,11 +251,13 @@ class SentryBridge {
   }
 
   public captureMessage(message: string, level: string): string {
-    return Sentry.captureMessage(message, level as Sentry.SeverityLevel);
+    return Sentry.getCurrentScope().captureMessage(message, level as Sentry.SeverityLevel, {
+      data: { [CAPTURE_SAMPLED_HINT]: true },
+    });
   }
 
   public captureEvent(event: Sentry.Event): string {
-    return Sentry.captureEvent(event);
+    return Sentry.captureEvent(event, { data: { [CAPTURE_SAMPLED_HINT]: true } });
   }
 
   public captureFeedback(message: string, name: string, email: string, associatedEventId: string): string {
@@ -6,8 +6,10 @@
 #include "sentry/javascript/javascript_string_names.h"
 #include "sentry/javascript/javascript_util.h"
 #include "sentry/logging/print.h"
+#include "sentry/options_snapshot.h"
 #include "sentry/processing/process_event.h"
 #include "sentry/processing/process_log.h"
+#include "sentry/sampling.h"
 #include "sentry/sentry_sdk.h"
 
 #include "gen/sdk_version.gen.h"
@@ -54,6 +56,31 @@ EM_JS(uint32_t, store_bytes, (const uint8_t *data, int size), {
 
 } //namespace em_js
 
+namespace {
+
+// Pushes attachment bytes to JS bridge layer and appends attachment descriptor to `p_out_attachments`.
+bool _push_attachment(const Ref<JavaScriptObject> &p_out_attachments, const PackedByteArray &p_bytes,
+		const String &p_filename, const String &p_attachment_type, const String &p_content_type) {
+	uint32_t bytes_id = em_js::store_bytes(p_bytes.ptr(), p_bytes.size());
+	if (bytes_id == 0) {
+		return false;
+	}
+
+	Ref<JavaScriptObject> attachment_data = JavaScriptBridge::get_singleton()->create_object(JAVASCRIPT_SN(Object));
+	attachment_data->set(JAVASCRIPT_SN(id), bytes_id);
+	attachment_data->set(JAVASCRIPT_SN(filename), p_filename);
+	if (!p_attachment_type.is_empty()) {
+		attachment_data->set(JAVASCRIPT_SN(attachmentType), p_attachment_type);
+	}
+	if (!p_content_type.is_empty()) {
+		attachment_data->set(JAVASCRIPT_SN(contentType), p_content_type);
+	}
+	p_out_attachments->call(JAVASCRIPT_SN(push), attachment_data);
+	return true;
+}
+
+} // unnamed namespace
+
 namespace sentry::javascript {
 
 // *** JavaScriptBeforeSendHandler
@@ -71,6 +98,14 @@ void JavaScriptBeforeSendHandler::handle_before_send(const Array &p_args) {
 	Ref<JavaScriptObject> out_attachments = p_args[1];
 	ERR_FAIL_COND(out_attachments.is_null());
 
+	// NOTE: Callbacks run asynchronously on this platform, so the thread-local sampling scope
+	//       is gone by now; the bridge flags events that were sampled before capture instead.
+	bool capture_sampled = event_obj->get(JAVASCRIPT_SN(captureSampled));
+	if (!capture_sampled && !sentry::sampling::sample_event()) {
+		event_obj->set(JAVASCRIPT_SN(shouldDiscard), true);
+		return;
+	}
+
 	Ref<JavaScriptEvent> event = memnew(JavaScriptEvent(event_obj));
 	Ref<JavaScriptEvent> processed = sentry::process_event(event);
 
@@ -82,6 +117,14 @@ void JavaScriptBeforeSendHandler::handle_before_send(const Array &p_args) {
 	} else {
 		event_obj->set(JAVASCRIPT_SN(shouldDiscard), false);
 
+		// Include in-memory attachments produced for this event (e.g. screenshot).
+		for (const Ref<SentryAttachment> &att : event->get_attachments()) {
+			sentry::logging::print_debug("Adding event attachment: " + att->get_filename());
+			if (!_push_attachment(out_attachments, att->get_bytes(), att->get_filename(), att->get_attachment_type(), att->get_content_type())) {
+				sentry::logging::print_warning("Failed to push attachment bytes to JS: " + att->get_filename());
+			}
+		}
+
 		// Read file-based attachments and include them with the event.
 		Vector<Ref<SentryAttachment>> file_attachments = _file_attachments_getter.call();
 		for (const Ref<SentryAttachment> &att : file_attachments) {
@@ -106,22 +149,9 @@ void JavaScriptBeforeSendHandler::handle_before_send(const Array &p_args) {
 
 			sentry::logging::print_debug("Adding attachment: " + att->get_path());
 
-			uint32_t bytes_id = em_js::store_bytes(bytes.ptr(), bytes.size());
-			if (bytes_id == 0) {
+			if (!_push_attachment(out_attachments, bytes, att->get_path().get_file(), att->get_attachment_type(), att->get_content_type())) {
 				sentry::logging::print_warning("Failed to push attachment bytes to JS: " + att->get_path());
-				continue;
-			}
-
-			Ref<JavaScriptObject> attachment_data = JavaScriptBridge::get_singleton()->create_object(JAVASCRIPT_SN(Object));
-			attachment_data->set(JAVASCRIPT_SN(id), bytes_id);
-			attachment_data->set(JAVASCRIPT_SN(filename), att->get_path().get_file());
-			if (!att->get_attachment_type().is_empty()) {
-				attachment_data->set(JAVASCRIPT_SN(attachmentType), att->get_attachment_type());
-			}
-			if (!att->get_content_type().is_empty()) {
-				attachment_data->set(JAVASCRIPT_SN(contentType), att->get_content_type());
 			}
-			out_attachments->call(JAVASCRIPT_SN(push), attachment_data);
 		}
 	}
 }
@@ -282,6 +312,7 @@ void JavaScriptSDK::init(const PackedStringArray &p_global_attachments, const Ca
 
 	if (p_configuration_callback.is_valid()) {
 		p_configuration_callback.call(SENTRY_OPTIONS());
+		sentry::options_snapshot::publish(SENTRY_OPTIONS().ptr());
 	}
 
 	file_attachments.clear();
@@ -313,7 +344,7 @@ void JavaScriptSDK::init(const PackedStringArray &p_global_attachments, const Ca
 			SENTRY_OPTIONS()->get_release(),
 			SENTRY_OPTIONS()->get_dist(),
 			SENTRY_OPTIONS()->get_environment(),
-			SENTRY_OPTIONS()->get_sample_rate(),
+			1.0, // error events are sampled by the SDK before they are built (see sampling.h)
 			SENTRY_OPTIONS()->get_max_breadcrumbs(),
 			SENTRY_OPTIONS()->get_enable_logs(),
 			String(SENTRY_GODOT_SDK_VERSION));
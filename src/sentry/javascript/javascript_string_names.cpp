@@ -24,6 +24,7 @@ JavaScriptStringNames::JavaScriptStringNames() {
 	captureEvent = StringName("captureEvent");
 	captureFeedback = StringName("captureFeedback");
 	captureMessage = StringName("captureMessage");
+	captureSampled = StringName("captureSampled");
 	category = StringName("category");
 	close = StringName("close");
 	contentType = StringName("contentType");
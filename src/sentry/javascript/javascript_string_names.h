@@ -35,6 +35,7 @@ public:
 	StringName captureEvent;
 	StringName captureFeedback;
 	StringName captureMessage;
+	StringName captureSampled;
 	StringName category;
 	StringName close;
 	StringName contentType;
@@ -3,6 +3,7 @@
 
 #include "sentry/level.h"
 #include "sentry/logging/state.h"
+#include "sentry/options_snapshot.h"
 #include "sentry/sentry_sdk.h"
 
 #include <cstdio>
@@ -15,10 +16,11 @@ namespace sentry::logging {
 
 template <typename... Args>
 void print_no_logger(sentry::Level p_level, const Variant &p_arg1, const Args &...p_args) {
-	if (!SENTRY_OPTIONS()->is_debug_enabled() && p_level < sentry::LEVEL_ERROR) {
+	const OptionsSnapshot *options = sentry::options_snapshot::get();
+	if (!options->debug && p_level < sentry::LEVEL_ERROR) {
 		return;
 	}
-	if (SENTRY_OPTIONS()->get_diagnostic_level() > p_level) {
+	if (options->diagnostic_level > p_level) {
 		return;
 	}
 
@@ -60,10 +62,11 @@ void print(sentry::Level p_level, const Variant &p_arg1, const Args &...p_args)
 		return;
 	}
 
-	if (!SENTRY_OPTIONS()->is_debug_enabled() && p_level < sentry::LEVEL_ERROR) {
+	const OptionsSnapshot *options = sentry::options_snapshot::get();
+	if (!options->debug && p_level < sentry::LEVEL_ERROR) {
 		return;
 	}
-	if (SENTRY_OPTIONS()->get_diagnostic_level() > p_level) {
+	if (options->diagnostic_level > p_level) {
 		return;
 	}
 
@@ -2,8 +2,13 @@
 
 #include "sentry/logging/print.h"
 #include "sentry/logging/state.h"
+#include "sentry/options_snapshot.h"
+#include "sentry/sampling.h"
 #include "sentry/sentry_options.h"
+#include "sentry/script_profiler.h"
 #include "sentry/sentry_sdk.h"
+#include "sentry/telemetry.h"
+#include "sentry/thread_locations.h"
 #include "sentry/util/hash.h"
 
 #include <godot_cpp/classes/engine.hpp>
@@ -79,6 +84,7 @@ Vector<SentryEvent::StackFrame> _extract_error_stack_frames_from_backtraces(
 		const TypedArray<ScriptBacktrace> &p_backtraces,
 		const String &p_file,
 		int p_line,
+		bool p_include_source,
 		bool p_include_variables) {
 	Vector<SentryEvent::StackFrame> frames;
 
@@ -115,7 +121,7 @@ Vector<SentryEvent::StackFrame> _extract_error_stack_frames_from_backtraces(
 			};
 
 			// Provide script source code context for script errors if available.
-			if (SENTRY_OPTIONS()->is_logger_include_source_enabled()) {
+			if (p_include_source) {
 				String context_line;
 				PackedStringArray pre_context;
 				PackedStringArray post_context;
@@ -239,7 +245,7 @@ void SentryGodotLogger::_disconnect_process_frame() {
 
 void SentryGodotLogger::_process_frame() {
 	// NOTE: It's important not to push errors from within this function to avoid deadlocks.
-	std::lock_guard lock{ error_mutex };
+	auto lock = sentry::telemetry::lock_measured(error_mutex, sentry::telemetry::ERROR_MUTEX_WAIT_USEC);
 
 	// After 10 frames have passed, switch from startup limits (more permissive)
 	// to normal limits for error throttling. This allows capturing more errors
@@ -247,6 +253,13 @@ void SentryGodotLogger::_process_frame() {
 	Engine *engine = Engine::get_singleton();
 	if (engine && engine->get_process_frames() == 10) {
 		_apply_normal_limits();
+	} else if (unlikely(limits_version != sentry::options_snapshot::get()->version)) {
+		// Limits were updated at runtime.
+		if (engine && engine->get_process_frames() < 10) {
+			_apply_startup_limits();
+		} else {
+			_apply_normal_limits();
+		}
 	}
 
 	// Reset per-frame counter.
@@ -265,21 +278,23 @@ void SentryGodotLogger::_process_frame() {
 }
 
 void SentryGodotLogger::_apply_startup_limits() {
-	Ref<SentryLoggerLimits> logger_limits = SENTRY_OPTIONS()->get_logger_limits();
+	const OptionsSnapshot *options = sentry::options_snapshot::get();
+	limits_version = options->version;
 
-	limits.events_per_frame = MAX(30, logger_limits->events_per_frame);
-	limits.repeated_error_window = std::chrono::milliseconds{ logger_limits->repeated_error_window_ms };
-	limits.throttle_events = MAX(30, logger_limits->throttle_events);
+	limits.events_per_frame = MAX(30, options->events_per_frame);
+	limits.repeated_error_window = std::chrono::milliseconds{ options->repeated_error_window_ms };
+	limits.throttle_events = MAX(30, options->throttle_events);
 	limits.throttle_window = std::chrono::milliseconds{ 0 };
 }
 
 void SentryGodotLogger::_apply_normal_limits() {
-	Ref<SentryLoggerLimits> logger_limits = SENTRY_OPTIONS()->get_logger_limits();
+	const OptionsSnapshot *options = sentry::options_snapshot::get();
+	limits_version = options->version;
 
-	limits.events_per_frame = logger_limits->events_per_frame;
-	limits.repeated_error_window = std::chrono::milliseconds{ logger_limits->repeated_error_window_ms };
-	limits.throttle_events = logger_limits->throttle_events;
-	limits.throttle_window = std::chrono::milliseconds{ logger_limits->throttle_window_ms };
+	limits.events_per_frame = options->events_per_frame;
+	limits.repeated_error_window = std::chrono::milliseconds{ options->repeated_error_window_ms };
+	limits.throttle_events = options->throttle_events;
+	limits.throttle_window = std::chrono::milliseconds{ options->throttle_window_ms };
 }
 
 void SentryGodotLogger::_log_error(const String &p_function, const String &p_file, int32_t p_line,
@@ -289,14 +304,29 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 		return;
 	}
 
+	sentry::telemetry::ScopedTimer telemetry_timer{ sentry::telemetry::LOG_ERROR_USEC };
+	sentry::script_profiler::sample_point(p_script_backtraces);
+
 	static thread_local uint32_t num_entries = 0;
 	constexpr uint32_t MAX_ENTRIES = 5;
 	RecursionGuard feedback_loop_guard{ &num_entries, MAX_ENTRIES };
 	if (!feedback_loop_guard.can_enter()) {
 		ERR_PRINT_ONCE("SentryGodotLogger::_log_error() feedback loop detected.");
+		sentry::telemetry::add(sentry::telemetry::LOGGER_SUPPRESSED);
 		return;
 	}
 
+	// Remember where this thread was last seen running -- read by native crash handler.
+	Ref<ScriptBacktrace> top_backtrace = p_script_backtraces.is_empty() ? Ref<ScriptBacktrace>() : Ref<ScriptBacktrace>(p_script_backtraces[0]);
+	if (top_backtrace.is_valid() && top_backtrace->get_frame_count() > 0) {
+		sentry::thread_locations::set_script_location(
+				top_backtrace->get_frame_file(0),
+				top_backtrace->get_frame_function(0),
+				top_backtrace->get_frame_line(0));
+	} else {
+		sentry::thread_locations::set_script_location(p_file, p_function, p_line);
+	}
+
 	String error_message = p_rationale.is_empty() ? p_code : p_rationale;
 	String error_type = error_type_as_string[int(p_error_type)];
 
@@ -307,12 +337,15 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 
 	TimePoint now = std::chrono::high_resolution_clock::now();
 
+	// Copied, as the snapshot may be reclaimed while this call blocks on the mutex or runs user callbacks.
+	const OptionsSnapshot options = *sentry::options_snapshot::get();
+
 	bool as_event = false;
 	bool as_breadcrumb = false;
 	bool as_log = false;
 
 	{
-		std::lock_guard lock{ error_mutex };
+		auto lock = sentry::telemetry::lock_measured(error_mutex, sentry::telemetry::ERROR_MUTEX_WAIT_USEC);
 
 		// Reject errors based on per-source-line throttling window to prevent
 		// repetitive logging caused by loops or errors recurring in each frame.
@@ -323,13 +356,18 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 		bool within_frame_limit = frame_events < limits.events_per_frame;
 		bool within_throttling_limit = event_times.size() < limits.throttle_events || limits.throttle_window.count() == 0;
 
-		as_event = SENTRY_OPTIONS()->should_capture_event((GodotErrorType)p_error_type) &&
-				within_frame_limit &&
-				within_throttling_limit &&
-				!is_spammy_error;
-		as_breadcrumb = SENTRY_OPTIONS()->should_capture_breadcrumb((GodotErrorType)p_error_type) &&
+		bool wants_event = options.should_capture_event((GodotErrorType)p_error_type);
+		bool within_limits = within_frame_limit && within_throttling_limit && !is_spammy_error;
+		if (wants_event && !within_limits) {
+			sentry::telemetry::add(sentry::telemetry::EVENTS_DROPPED_LIMITS);
+		}
+
+		as_event = wants_event &&
+				within_limits &&
+				sentry::sampling::sample_event(); // decided before any payload is built
+		as_breadcrumb = options.should_capture_breadcrumb((GodotErrorType)p_error_type) &&
 				!is_spammy_error;
-		as_log = SENTRY_OPTIONS()->get_enable_logs() &&
+		as_log = options.enable_logs &&
 				!is_spammy_error;
 
 		if (as_event) {
@@ -346,6 +384,7 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 
 	if (!as_breadcrumb && !as_event && !as_log) {
 		sentry::logging::print_debug("error capture skipped due to limits");
+		sentry::telemetry::add(sentry::telemetry::LOGGER_SUPPRESSED);
 		return;
 	}
 
@@ -359,11 +398,11 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 	// Capture error as event.
 	if (as_event) {
 		// Backtraces don't include variables by default, so if we need them, we must capture them separately.
-		bool include_variables = SENTRY_OPTIONS()->is_logger_include_variables_enabled();
+		bool include_variables = options.logger_include_variables;
 		TypedArray<ScriptBacktrace> script_backtraces = include_variables ? Engine::get_singleton()->capture_script_backtraces(true) : p_script_backtraces;
 
 		Vector<SentryEvent::StackFrame> frames = _extract_error_stack_frames_from_backtraces(
-				script_backtraces, p_file, p_line, include_variables);
+				script_backtraces, p_file, p_line, options.logger_include_source, include_variables);
 
 		if (p_error_type == ErrorType::ERROR_TYPE_ERROR) {
 			// Add native frame to the top so it is preserved as the source of error.
@@ -379,7 +418,9 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 		};
 		ev->add_exception(exception);
 		ev->set_logger(logger_name);
-		event_uuid = SentrySDK::get_singleton()->capture_event(ev);
+		// Sampling decision was made above.
+		sentry::sampling::SampledCaptureScope sampled;
+		event_uuid = SentrySDK::get_singleton()->get_internal_sdk()->capture_event(ev);
 	}
 
 	// Capture error as breadcrumb.
@@ -431,6 +472,7 @@ void SentryGodotLogger::_log_error(const String &p_function, const String &p_fil
 		}
 
 		SentrySDK::get_singleton()->get_internal_sdk()->log(log_level, body, attributes);
+		sentry::telemetry::add(sentry::telemetry::LOGS_ADDED);
 	}
 }
 
@@ -441,18 +483,24 @@ void SentryGodotLogger::_log_message(const String &p_message, bool p_error) {
 		return;
 	}
 
-	bool as_log = SENTRY_OPTIONS()->get_enable_logs();
-	bool as_breadcrumb = SENTRY_OPTIONS()->is_logger_messages_as_breadcrumbs_enabled();
+	sentry::script_profiler::sample_point();
+
+	const OptionsSnapshot *options = sentry::options_snapshot::get();
+	bool as_log = options->enable_logs;
+	bool as_breadcrumb = options->logger_messages_as_breadcrumbs;
 
 	if (!as_log && !as_breadcrumb) {
 		return;
 	}
 
+	sentry::telemetry::ScopedTimer telemetry_timer{ sentry::telemetry::LOG_MESSAGE_USEC };
+
 	static thread_local uint32_t num_entries = 0;
 	constexpr uint32_t MAX_ENTRIES = 5;
 	RecursionGuard feedback_loop_guard{ &num_entries, MAX_ENTRIES };
 	if (!feedback_loop_guard.can_enter()) {
 		ERR_PRINT_ONCE("SentryGodotLogger::_log_message() feedback loop detected.");
+		sentry::telemetry::add(sentry::telemetry::LOGGER_SUPPRESSED);
 		return;
 	}
 
@@ -466,6 +514,7 @@ void SentryGodotLogger::_log_message(const String &p_message, bool p_error) {
 	// Filtering: Check message prefixes to skip certain messages (e.g., Sentry's own debug output).
 	for (const String &prefix : filter_by_prefix) {
 		if (processed_message.begins_with(prefix)) {
+			sentry::telemetry::add(sentry::telemetry::LOGGER_SUPPRESSED);
 			return;
 		}
 	}
@@ -473,6 +522,7 @@ void SentryGodotLogger::_log_message(const String &p_message, bool p_error) {
 	if (as_log) {
 		sentry::LogLevel level = p_error ? LOG_LEVEL_ERROR : LOG_LEVEL_INFO;
 		SentrySDK::get_singleton()->get_internal_sdk()->log(level, processed_message, log_attributes);
+		sentry::telemetry::add(sentry::telemetry::LOGS_ADDED);
 	}
 
 	if (as_breadcrumb) {
@@ -2,6 +2,7 @@
 #define SENTRY_LOGGER_H
 
 #include "sentry/godot_error_types.h"
+#include "sentry/options_snapshot.h"
 
 #include <chrono>
 #include <deque>
@@ -31,6 +32,7 @@ class SentryGodotLogger : public Logger {
 
 private:
 	using GodotErrorType = sentry::GodotErrorType;
+	using OptionsSnapshot = sentry::OptionsSnapshot;
 	using TimePoint = std::chrono::high_resolution_clock::time_point;
 
 	String logger_name;
@@ -43,6 +45,9 @@ private:
 		int throttle_events;
 	} limits;
 
+	// Version of the snapshot the limits were taken from, to pick up limits updated at runtime.
+	uint64_t limits_version = 0;
+
 	struct ErrorKey {
 		String message;
 		String file;
@@ -0,0 +1,394 @@
+#include "metrics.h"
+
+#include "sentry/logging/print.h"
+#include "sentry/sentry_sdk.h"
+
+#include <cmath>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <mutex>
+
+namespace {
+
+using Type = sentry::metrics::Type;
+
+// Limits memory used by a single set metric within a flush interval.
+constexpr uint32_t MAX_SET_SIZE = 10'000;
+
+struct MetricTag {
+	StringName key;
+	Variant value;
+};
+
+// Tags are kept in the order they were given, and converted to strings only when flushing.
+struct MetricKey {
+	Type type = sentry::metrics::COUNTER;
+	StringName name;
+	LocalVector<MetricTag> tags;
+	uint32_t tags_hash = 0; // independent of tag order
+
+	bool operator==(const MetricKey &p_other) const {
+		if (type != p_other.type || tags_hash != p_other.tags_hash || tags.size() != p_other.tags.size() || name != p_other.name) {
+			return false;
+		}
+		for (const MetricTag &tag : tags) {
+			const MetricTag *match = nullptr;
+			for (const MetricTag &other : p_other.tags) {
+				if (other.key == tag.key) {
+					match = &other;
+					break;
+				}
+			}
+			if (match == nullptr || match->value != tag.value) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+struct MetricKeyHasher {
+	static _FORCE_INLINE_ uint32_t hash(const MetricKey &p_key) {
+		uint32_t h = hash_murmur3_one_32(p_key.type);
+		h = hash_murmur3_one_32(p_key.name.hash(), h);
+		h = hash_murmur3_one_32(p_key.tags_hash, h);
+		return hash_fmix32(h);
+	}
+};
+
+struct Aggregate {
+	int64_t count = 0;
+	double sum = 0.0;
+	double min = INFINITY;
+	double max = -INFINITY;
+	double last = 0.0;
+	HashSet<uint32_t> unique;
+
+	_FORCE_INLINE_ void add(Type p_type, double p_value) {
+		count++;
+		if (p_type == sentry::metrics::SET) {
+			if (unique.size() < MAX_SET_SIZE) {
+				unique.insert((uint32_t)p_value);
+			}
+			return;
+		}
+		sum += p_value;
+		min = MIN(min, p_value);
+		max = MAX(max, p_value);
+		last = p_value;
+	}
+
+	void merge(const Aggregate &p_other) {
+		count += p_other.count;
+		sum += p_other.sum;
+		min = MIN(min, p_other.min);
+		max = MAX(max, p_other.max);
+		last = p_other.last;
+		for (uint32_t value : p_other.unique) {
+			if (unique.size() >= MAX_SET_SIZE) {
+				break;
+			}
+			unique.insert(value);
+		}
+	}
+};
+
+using Buckets = HashMap<MetricKey, Aggregate, MetricKeyHasher>;
+
+struct ThreadBuffer {
+	// Held by the owning thread while recording, and by the flush while taking the buckets.
+	std::atomic<bool> busy{ false };
+	Buckets buckets;
+
+	_FORCE_INLINE_ void lock() {
+		while (busy.exchange(true, std::memory_order_acquire)) {
+		}
+	}
+	_FORCE_INLINE_ void unlock() { busy.store(false, std::memory_order_release); }
+};
+
+// Guards the list of buffers, and buckets of threads that have exited.
+std::mutex registry_mutex;
+LocalVector<ThreadBuffer *> buffers;
+Buckets retired_buckets;
+
+uint64_t window_start_msec = 0;
+uint64_t flush_interval_msec = 10'000;
+
+// Aggregates keyed by their string form, as reported in a batch.
+struct Batch {
+	HashMap<String, Aggregate> aggregates;
+	HashMap<String, Type> types;
+	uint64_t interval_msec = 0;
+
+	void merge(const Batch &p_other);
+	Dictionary to_dictionary() const;
+};
+
+// Flushed batches merged together, until an event takes them.
+std::mutex batch_mutex;
+Batch pending_batch;
+
+void _merge_into(Buckets &p_target, const Buckets &p_source) {
+	for (const KeyValue<MetricKey, Aggregate> &kv : p_source) {
+		if (Aggregate *existing = p_target.getptr(kv.key)) {
+			existing->merge(kv.value);
+		} else {
+			p_target.insert(kv.key, kv.value);
+		}
+	}
+}
+
+// Releases the buffer when the owning thread exits, keeping its unflushed buckets.
+struct BufferHandle {
+	ThreadBuffer *buffer = nullptr;
+
+	~BufferHandle() {
+		if (buffer == nullptr) {
+			return;
+		}
+		std::lock_guard lock(registry_mutex);
+		_merge_into(retired_buckets, buffer->buckets);
+		buffers.erase(buffer);
+		delete buffer;
+	}
+};
+
+thread_local BufferHandle buffer_handle;
+
+ThreadBuffer *_get_thread_buffer() {
+	if (likely(buffer_handle.buffer)) {
+		return buffer_handle.buffer;
+	}
+	ThreadBuffer *buffer = new ThreadBuffer;
+	{
+		std::lock_guard lock(registry_mutex);
+		buffers.push_back(buffer);
+	}
+	buffer_handle.buffer = buffer;
+	return buffer;
+}
+
+void _set_tags(MetricKey &r_key, const Dictionary &p_tags) {
+	Array keys = p_tags.keys();
+	r_key.tags.resize(keys.size());
+	for (int i = 0; i < keys.size(); i++) {
+		const Variant &key = keys[i];
+		MetricTag &tag = r_key.tags[i];
+		// StringName keys are used as is, without interning a string on each call.
+		tag.key = key.get_type() == Variant::STRING_NAME ? (StringName)key : StringName(key.stringify());
+		tag.value = p_tags[key];
+		r_key.tags_hash += hash_murmur3_one_32(tag.value.hash(), tag.key.hash());
+	}
+}
+
+// Tags sorted by key, as "key=value" pairs joined with ",".
+String _tags_to_string(const LocalVector<MetricTag> &p_tags) {
+	PackedStringArray pairs;
+	for (const MetricTag &tag : p_tags) {
+		pairs.push_back(String(tag.key) + "=" + tag.value.stringify());
+	}
+	pairs.sort();
+	return String(",").join(pairs);
+}
+
+const char *_type_prefix(Type p_type) {
+	switch (p_type) {
+		case sentry::metrics::COUNTER:
+			return "c";
+		case sentry::metrics::GAUGE:
+			return "g";
+		case sentry::metrics::DISTRIBUTION:
+			return "d";
+		case sentry::metrics::SET:
+			return "s";
+	}
+	return "";
+}
+
+// Compact representation of an aggregate, depending on type:
+// counter: sum; gauge: [last, min, max, sum, count]; distribution: [count, sum, min, max]; set: unique count.
+Variant _aggregate_to_variant(Type p_type, const Aggregate &p_aggregate) {
+	switch (p_type) {
+		case sentry::metrics::COUNTER:
+			return p_aggregate.sum;
+		case sentry::metrics::GAUGE:
+			return Array::make(p_aggregate.last, p_aggregate.min, p_aggregate.max, p_aggregate.sum, p_aggregate.count);
+		case sentry::metrics::DISTRIBUTION:
+			return Array::make(p_aggregate.count, p_aggregate.sum, p_aggregate.min, p_aggregate.max);
+		case sentry::metrics::SET:
+			return (int64_t)p_aggregate.unique.size();
+	}
+	return Variant();
+}
+
+void Batch::merge(const Batch &p_other) {
+	for (const KeyValue<String, Aggregate> &kv : p_other.aggregates) {
+		if (Aggregate *existing = aggregates.getptr(kv.key)) {
+			existing->merge(kv.value);
+		} else {
+			aggregates.insert(kv.key, kv.value);
+			types.insert(kv.key, p_other.types[kv.key]);
+		}
+	}
+	interval_msec += p_other.interval_msec;
+}
+
+Dictionary Batch::to_dictionary() const {
+	if (aggregates.is_empty()) {
+		return Dictionary();
+	}
+
+	Dictionary values;
+	for (const KeyValue<String, Aggregate> &kv : aggregates) {
+		values[kv.key] = _aggregate_to_variant(types[kv.key], kv.value);
+	}
+
+	Dictionary batch;
+	batch["interval_sec"] = interval_msec / 1000.0;
+	batch["values"] = values;
+	return batch;
+}
+
+void _on_process_frame() {
+	uint64_t now = Time::get_singleton()->get_ticks_msec();
+	if (now - window_start_msec >= flush_interval_msec) {
+		sentry::metrics::flush();
+	}
+}
+
+void _connect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to start metrics - expected SceneTree instance as main loop.");
+
+	Callable callable = callable_mp_static(&_on_process_frame);
+	if (!scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->connect("process_frame", callable);
+	}
+}
+
+} // unnamed namespace
+
+namespace sentry::metrics {
+
+std::atomic<bool> active{ false };
+
+void record(Type p_type, const StringName &p_name, double p_value, const Dictionary &p_tags) {
+	ERR_FAIL_COND_MSG(p_name.is_empty(), "Sentry: Metric name can't be empty.");
+
+	MetricKey key{ p_type, p_name };
+	if (!p_tags.is_empty()) {
+		_set_tags(key, p_tags);
+	}
+
+	ThreadBuffer *buffer = _get_thread_buffer();
+	buffer->lock();
+	if (Aggregate *aggregate = buffer->buckets.getptr(key)) {
+		aggregate->add(p_type, p_value);
+	} else {
+		buffer->buckets.insert(key, Aggregate())->value.add(p_type, p_value);
+	}
+	buffer->unlock();
+}
+
+void start() {
+	if (!SENTRY_OPTIONS()->get_enable_metrics()) {
+		return;
+	}
+
+	flush_interval_msec = MAX(1, SENTRY_OPTIONS()->get_metrics_flush_interval_sec()) * 1000;
+	window_start_msec = Time::get_singleton()->get_ticks_msec();
+	{
+		std::lock_guard lock(batch_mutex);
+		pending_batch = Batch();
+	}
+	active = true;
+
+	sentry::logging::print_debug("Starting metrics aggregation");
+
+	if (Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop())) {
+		_connect_process_frame();
+	} else {
+		// SceneTree is not available during early initialization.
+		callable_mp_static(&_connect_process_frame).call_deferred();
+	}
+}
+
+void stop() {
+	if (!active) {
+		return;
+	}
+
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Callable callable = callable_mp_static(&_on_process_frame);
+	if (scene_tree && scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->disconnect("process_frame", callable);
+	}
+
+	// Final batch is attached to events captured during shutdown.
+	flush();
+	active = false;
+}
+
+Dictionary flush() {
+	uint64_t now = Time::get_singleton()->get_ticks_msec();
+	uint64_t window_msec = now - window_start_msec;
+	window_start_msec = now;
+
+	Buckets merged;
+	{
+		std::lock_guard lock(registry_mutex);
+		for (ThreadBuffer *buffer : buffers) {
+			Buckets taken;
+			buffer->lock();
+			SWAP(taken, buffer->buckets);
+			buffer->unlock();
+			_merge_into(merged, taken);
+		}
+		_merge_into(merged, retired_buckets);
+		retired_buckets.clear();
+	}
+
+	if (merged.is_empty()) {
+		return Dictionary();
+	}
+
+	// Tag values that differ in type, such as 1 and "1", end up under the same key.
+	Batch batch;
+	batch.interval_msec = window_msec;
+	for (const KeyValue<MetricKey, Aggregate> &kv : merged) {
+		String key = String(_type_prefix(kv.key.type)) + ":" + String(kv.key.name);
+		if (!kv.key.tags.is_empty()) {
+			key += "|" + _tags_to_string(kv.key.tags);
+		}
+		if (Aggregate *existing = batch.aggregates.getptr(key)) {
+			existing->merge(kv.value);
+		} else {
+			batch.aggregates.insert(key, kv.value);
+			batch.types.insert(key, kv.key.type);
+		}
+	}
+
+	if (active) {
+		std::lock_guard lock(batch_mutex);
+		pending_batch.merge(batch);
+	}
+	return batch.to_dictionary();
+}
+
+Dictionary take_batch() {
+	Batch batch;
+	{
+		std::lock_guard lock(batch_mutex);
+		SWAP(batch, pending_batch);
+	}
+	return batch.to_dictionary();
+}
+
+} //namespace sentry::metrics
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+using namespace godot;
+
+// In-process aggregation of metrics (see SentryMetrics).
+//
+// Each thread records into its own buckets, keyed by type, name and tags. Names and tag keys are
+// StringNames, whose hashes are precomputed, and tags are only converted to strings when flushing.
+// A bucket is guarded by a spin flag that only the flush contends for, so recording costs a hash
+// lookup and an uncontended atomic exchange. The main thread merges all buckets on an interval.
+//
+// Metrics are not sent on their own: flushed batches are merged until the next event that passes
+// event processors and before_send takes them as "metrics" context, so that they are reported at
+// most once and aren't lost with dropped events.
+namespace sentry::metrics {
+
+enum Type : uint8_t {
+	COUNTER,
+	GAUGE,
+	DISTRIBUTION,
+	SET,
+};
+
+extern std::atomic<bool> active;
+
+void record(Type p_type, const StringName &p_name, double p_value, const Dictionary &p_tags);
+
+_FORCE_INLINE_ bool is_active() { return active.load(std::memory_order_relaxed); }
+
+// Must be called on the main thread.
+void start();
+void stop();
+
+// Merges buckets of all threads into a batch, which is merged into the pending batch until an
+// event takes it. Returns the new batch, which is empty if nothing was recorded since the last flush.
+Dictionary flush();
+
+// Returns the pending batch and clears it, or an empty dictionary if there is none.
+// Safe to call from any thread.
+Dictionary take_batch();
+
+} //namespace sentry::metrics
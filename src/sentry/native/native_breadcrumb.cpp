@@ -1,79 +1,50 @@
 #include "native_breadcrumb.h"
 
-#include "godot_cpp/core/error_macros.hpp"
-#include "sentry/native/native_util.h"
-
-#include <sentry.h>
-
 namespace sentry::native {
 
 void NativeBreadcrumb::set_message(const String &p_message) {
-	sentry::native::sentry_value_set_or_remove_string_by_key(native_crumb, "message", p_message);
+	record.message = p_message.utf8();
 }
 
 String NativeBreadcrumb::get_message() const {
-	return String::utf8(sentry_value_as_string(
-			sentry_value_get_by_key(native_crumb, "message")));
+	return String::utf8(record.message.get_data(), record.message.length());
 }
 
 void NativeBreadcrumb::set_category(const String &p_category) {
-	sentry::native::sentry_value_set_or_remove_string_by_key(native_crumb, "category", p_category);
+	record.category = p_category;
 }
 
 String NativeBreadcrumb::get_category() const {
-	return String::utf8(sentry_value_as_string(
-			sentry_value_get_by_key(native_crumb, "category")));
+	return record.category;
 }
 
 void NativeBreadcrumb::set_level(sentry::Level p_level) {
-	sentry_value_set_by_key(native_crumb, "level",
-			sentry_value_new_string(sentry::native::level_to_cstring(p_level)));
+	record.level = p_level;
 }
 
 sentry::Level NativeBreadcrumb::get_level() const {
-	sentry_value_t value = sentry_value_get_by_key(native_crumb, "level");
-	if (sentry_value_is_null(value)) {
-		return sentry::Level::LEVEL_INFO;
-	}
-	return sentry::native::cstring_to_level(sentry_value_as_string(value));
+	return record.level;
 }
 
 void NativeBreadcrumb::set_type(const String &p_type) {
-	sentry::native::sentry_value_set_or_remove_string_by_key(native_crumb, "type", p_type);
+	record.type = p_type;
 }
 
 String NativeBreadcrumb::get_type() const {
-	return String::utf8(sentry_value_as_string(
-			sentry_value_get_by_key(native_crumb, "type")));
+	return record.type;
 }
 
 void NativeBreadcrumb::set_data(const Dictionary &p_data) {
-	sentry_value_t native_data = sentry::native::variant_to_sentry_value(p_data);
-	sentry_value_set_by_key(native_crumb, "data", native_data);
+	// Deep copy: the record is read from other threads when events are captured.
+	record.data = p_data.duplicate(true);
 }
 
 Ref<SentryTimestamp> NativeBreadcrumb::get_timestamp() {
-	sentry_value_t value = sentry_value_get_by_key(native_crumb, "timestamp");
-	return SentryTimestamp::parse_rfc3339_cstr(sentry_value_as_string(value));
-}
-
-NativeBreadcrumb::NativeBreadcrumb(sentry_value_t p_native_crumb) {
-	if (sentry_value_refcount(p_native_crumb) > 0) {
-		sentry_value_incref(p_native_crumb); // acquire ownership
-		native_crumb = p_native_crumb;
-	} else {
-		// Shouldn't happen in healthy code.
-		native_crumb = sentry_value_new_breadcrumb(NULL, NULL);
-		ERR_PRINT_ONCE("Sentry: Internal error: Breadcrumb refcount is zero.");
-	}
+	return SentryTimestamp::from_microseconds_since_unix_epoch(record.timestamp_usec);
 }
 
 NativeBreadcrumb::NativeBreadcrumb() {
-	native_crumb = sentry_value_new_breadcrumb(NULL, NULL);
-}
-
-NativeBreadcrumb::~NativeBreadcrumb() {
-	sentry_value_decref(native_crumb); // release ownership
+	record.timestamp_usec = breadcrumbs::now_usec();
 }
 
 } //namespace sentry::native
@@ -1,23 +1,24 @@
 #ifndef NATIVE_BREADCRUMB_H
 #define NATIVE_BREADCRUMB_H
 
+#include "sentry/native/native_breadcrumb_buffer.h"
 #include "sentry/sentry_breadcrumb.h"
 
-#include <sentry.h>
-
 namespace sentry::native {
 
+// Breadcrumb fields are kept in compact form and only converted to sentry-native values
+// when an event is captured (see native_breadcrumb_buffer.h).
 class NativeBreadcrumb : public SentryBreadcrumb {
 	GDCLASS(NativeBreadcrumb, SentryBreadcrumb);
 
 private:
-	sentry_value_t native_crumb;
+	breadcrumbs::Record record;
 
 protected:
 	static void _bind_methods() {}
 
 public:
-	_FORCE_INLINE_ sentry_value_t get_native_breadcrumb() { return native_crumb; }
+	_FORCE_INLINE_ const breadcrumbs::Record &get_record() const { return record; }
 
 	virtual void set_message(const String &p_message) override;
 	virtual String get_message() const override;
@@ -35,9 +36,7 @@ public:
 
 	virtual Ref<SentryTimestamp> get_timestamp() override;
 
-	NativeBreadcrumb(sentry_value_t p_native_crumb);
 	NativeBreadcrumb();
-	virtual ~NativeBreadcrumb() override;
 };
 
 } //namespace sentry::native
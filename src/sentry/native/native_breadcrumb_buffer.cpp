@@ -0,0 +1,208 @@
+#include "native_breadcrumb_buffer.h"
+
+#include "sentry/native/native_util.h"
+#include "sentry/sentry_timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <mutex>
+
+namespace {
+
+using Record = sentry::native::breadcrumbs::Record;
+
+struct Ring {
+	std::mutex mutex;
+	LocalVector<Record> records;
+	uint32_t next = 0;
+	uint32_t count = 0;
+	std::atomic<bool> owned{ true };
+};
+
+std::atomic<int> capacity{ 100 };
+
+// Rings are never freed: threads keep pointers to them, and a ring released by an exited thread
+// is adopted by the next new thread (keeping its breadcrumbs).
+std::mutex registry_mutex;
+LocalVector<Ring *> rings;
+
+// Releases ring when the owning thread exits.
+struct RingHandle {
+	Ring *ring = nullptr;
+
+	~RingHandle() {
+		if (ring) {
+			ring->owned.store(false, std::memory_order_release);
+		}
+	}
+};
+
+thread_local RingHandle ring_handle;
+
+Ring *_get_thread_ring() {
+	if (likely(ring_handle.ring)) {
+		return ring_handle.ring;
+	}
+
+	std::lock_guard lock(registry_mutex);
+	for (Ring *ring : rings) {
+		bool expected = false;
+		if (ring->owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+			ring_handle.ring = ring;
+			return ring;
+		}
+	}
+
+	Ring *ring = memnew(Ring);
+	rings.push_back(ring);
+	ring_handle.ring = ring;
+	return ring;
+}
+
+const char *_level_name(sentry::Level p_level) {
+	switch (p_level) {
+		case sentry::LEVEL_DEBUG:
+			return "debug";
+		case sentry::LEVEL_WARNING:
+			return "warning";
+		case sentry::LEVEL_ERROR:
+			return "error";
+		case sentry::LEVEL_FATAL:
+			return "fatal";
+		default:
+			return "info";
+	}
+}
+
+// Formats RFC 3339 timestamp in UTC. Plain arithmetic -- usable in the crash handler.
+sentry_value_t _materialize(const Record &p_record, bool p_include_data) {
+	sentry_value_t crumb = sentry_value_new_object();
+
+	char timestamp[sentry::SentryTimestamp::RFC3339_BUFFER_SIZE];
+	if (sentry::SentryTimestamp::format_rfc3339(p_record.timestamp_usec, timestamp)) {
+		sentry_value_set_by_key(crumb, "timestamp", sentry_value_new_string(timestamp));
+	}
+	sentry_value_set_by_key(crumb, "level", sentry_value_new_string(_level_name(p_record.level)));
+
+	if (p_record.message.length() > 0) {
+		sentry_value_set_by_key(crumb, "message",
+				sentry_value_new_string(p_record.message.get_data()));
+	}
+	if (!p_record.category.is_empty()) {
+		sentry_value_set_by_key(crumb, "category", sentry_value_new_string(String(p_record.category).utf8()));
+	}
+	if (!p_record.type.is_empty()) {
+		sentry_value_set_by_key(crumb, "type", sentry_value_new_string(String(p_record.type).utf8()));
+	}
+	if (p_include_data && !p_record.data.is_empty()) {
+		sentry_value_set_by_key(crumb, "data", sentry::native::variant_to_sentry_value(p_record.data));
+	}
+
+	return crumb;
+}
+
+} // unnamed namespace
+
+namespace sentry::native::breadcrumbs {
+
+int64_t now_usec() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::system_clock::now().time_since_epoch())
+			.count();
+}
+
+void set_capacity(int p_capacity) {
+	capacity.store(MAX(p_capacity, 0), std::memory_order_relaxed);
+}
+
+void add(const Record &p_record) {
+	uint32_t cap = capacity.load(std::memory_order_relaxed);
+	if (cap == 0) {
+		return;
+	}
+
+	Ring *ring = _get_thread_ring();
+	std::lock_guard lock(ring->mutex);
+
+	if (unlikely(ring->records.size() != cap)) {
+		ring->records.clear();
+		ring->records.resize(cap);
+		ring->next = 0;
+		ring->count = 0;
+	}
+
+	ring->records[ring->next] = p_record;
+	ring->next = (ring->next + 1) % cap;
+	ring->count = MIN(ring->count + 1, cap);
+}
+
+void clear() {
+	std::lock_guard lock(registry_mutex);
+	for (Ring *ring : rings) {
+		std::lock_guard ring_lock(ring->mutex);
+		ring->records.clear();
+		ring->next = 0;
+		ring->count = 0;
+	}
+}
+
+void attach_to(sentry_value_t p_event, bool p_crashed, bool p_include_data) {
+	if (sentry_value_get_length(sentry_value_get_by_key(p_event, "breadcrumbs")) > 0) {
+		return;
+	}
+
+	uint32_t cap = capacity.load(std::memory_order_relaxed);
+	if (cap == 0) {
+		return;
+	}
+
+	std::unique_lock registry_lock(registry_mutex, std::defer_lock);
+	if (p_crashed) {
+		if (!registry_lock.try_lock()) {
+			return;
+		}
+	} else {
+		registry_lock.lock();
+	}
+
+	// Collect records of all rings, oldest first within each ring.
+	LocalVector<Ring *> locked;
+	LocalVector<const Record *> merged;
+	for (Ring *ring : rings) {
+		if (p_crashed) {
+			if (!ring->mutex.try_lock()) {
+				continue;
+			}
+		} else {
+			ring->mutex.lock();
+		}
+		locked.push_back(ring);
+
+		uint32_t size = ring->records.size();
+		uint32_t start = (ring->next + size - ring->count) % MAX(size, 1u);
+		for (uint32_t i = 0; i < ring->count; i++) {
+			merged.push_back(&ring->records[(start + i) % size]);
+		}
+	}
+
+	std::stable_sort(merged.ptr(), merged.ptr() + merged.size(),
+			[](const Record *a, const Record *b) { return a->timestamp_usec < b->timestamp_usec; });
+
+	// Only the newest breadcrumbs are shipped.
+	uint32_t first = merged.size() > cap ? merged.size() - cap : 0;
+	if (first < merged.size()) {
+		sentry_value_t list = sentry_value_new_list();
+		for (uint32_t i = first; i < merged.size(); i++) {
+			sentry_value_append(list, _materialize(*merged[i], p_include_data));
+		}
+		sentry_value_set_by_key(p_event, "breadcrumbs", list);
+	}
+
+	for (Ring *ring : locked) {
+		ring->mutex.unlock();
+	}
+}
+
+} //namespace sentry::native::breadcrumbs
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "sentry/level.h"
+
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <sentry.h>
+
+// Breadcrumbs are stored in per-thread rings as compact records and converted to sentry-native
+// values only when an event is captured. Adding a breadcrumb only touches the calling thread's
+// ring, which is otherwise locked only while an event is being assembled.
+//
+// Breadcrumbs are not passed to sentry-native's scope, so crash reports carry them only if our
+// on_crash hook runs and manages to lock the rings. Crash reports produced without the hook
+// (such as when the crashpad handler captures a crash the hook doesn't see) have no breadcrumbs.
+namespace sentry::native::breadcrumbs {
+
+struct Record {
+	int64_t timestamp_usec = 0;
+	sentry::Level level = sentry::LEVEL_INFO;
+	godot::StringName category; // interned
+	godot::StringName type; // interned
+	godot::CharString message;
+	godot::Dictionary data;
+};
+
+int64_t now_usec();
+
+// Sets the number of breadcrumbs retained per thread and attached to events.
+void set_capacity(int p_capacity);
+
+void add(const Record &p_record);
+void clear();
+
+// Merges the newest breadcrumbs from all threads into "breadcrumbs" of p_event, unless the event
+// already carries breadcrumbs. In the crash handler (p_crashed), locks are only tried, so that
+// rings held by the crashed thread are skipped instead of deadlocking. Data dictionaries are
+// converted only if p_include_data is true.
+void attach_to(sentry_value_t p_event, bool p_crashed, bool p_include_data = true);
+
+} //namespace sentry::native::breadcrumbs
@@ -0,0 +1,211 @@
+#include "native_crash_context.h"
+
+#include "sentry/contexts.h"
+#include "sentry/logging/print.h"
+#include "sentry/native/native_journal.h"
+#include "sentry/native/native_util.h"
+#include "sentry/thread_locations.h"
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+namespace {
+
+// Snapshot refresh interval (milliseconds).
+constexpr uint64_t REFRESH_INTERVAL_MSEC = 1000;
+
+struct Field {
+	CharString key;
+	sentry_value_t value;
+};
+
+struct Context {
+	CharString name;
+	LocalVector<Field> fields;
+};
+
+struct Snapshot {
+	LocalVector<Context> contexts;
+
+	~Snapshot() {
+		for (Context &ctx : contexts) {
+			for (Field &field : ctx.fields) {
+				sentry_value_decref(field.value);
+			}
+		}
+	}
+};
+
+// Published snapshot read by the crash handler.
+std::atomic<Snapshot *> current_snapshot{ nullptr };
+
+// Replaced snapshot is kept alive for one more refresh cycle, in case a crash handler
+// on another thread is still reading it.
+Snapshot *retired_snapshot = nullptr;
+
+uint64_t last_refresh_msec = 0;
+
+void _publish(Snapshot *p_snapshot) {
+	Snapshot *previous = current_snapshot.exchange(p_snapshot);
+	if (retired_snapshot) {
+		memdelete(retired_snapshot);
+	}
+	retired_snapshot = previous;
+}
+
+void _on_process_frame() {
+	uint64_t now = Time::get_singleton()->get_ticks_msec();
+	if (last_refresh_msec == 0 || now - last_refresh_msec >= REFRESH_INTERVAL_MSEC) {
+		sentry::native::crash_context::refresh();
+		last_refresh_msec = now;
+	}
+}
+
+void _connect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to schedule crash context refresh - expected SceneTree instance as main loop.");
+
+	Callable callable = callable_mp_static(&_on_process_frame);
+	if (!scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->connect("process_frame", callable);
+	}
+}
+
+} // unnamed namespace
+
+namespace sentry::native::crash_context {
+
+void refresh() {
+	HashMap<String, Dictionary> event_contexts = sentry::contexts::make_event_contexts();
+	if (event_contexts.is_empty()) {
+		return;
+	}
+
+	Snapshot *snapshot = memnew(Snapshot);
+	for (const auto &kv : event_contexts) {
+		Context ctx;
+		ctx.name = kv.key.utf8();
+
+		const Array &keys = kv.value.keys();
+		for (int i = 0; i < keys.size(); i++) {
+			const String &key = keys[i];
+			ctx.fields.push_back({ key.utf8(), sentry::native::variant_to_sentry_value(kv.value[key]) });
+		}
+		snapshot->contexts.push_back(ctx);
+	}
+
+	_publish(snapshot);
+
+	if (sentry::native::journal::is_open()) {
+		Dictionary contexts_dict;
+		for (const auto &kv : event_contexts) {
+			contexts_dict[kv.key] = kv.value;
+		}
+		sentry::native::journal::set_context_snapshot(JSON::stringify(contexts_dict).utf8());
+	}
+
+	// Track active scene of the main thread.
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	if (scene_tree && scene_tree->get_current_scene()) {
+		sentry::thread_locations::set_scene(scene_tree->get_current_scene()->get_scene_file_path());
+	}
+}
+
+void start_refreshing() {
+	last_refresh_msec = 0;
+	if (Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop())) {
+		_connect_process_frame();
+	} else {
+		// SceneTree is not available during early initialization.
+		callable_mp_static(&_connect_process_frame).call_deferred();
+	}
+}
+
+void stop_refreshing() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Callable callable = callable_mp_static(&_on_process_frame);
+	if (scene_tree && scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->disconnect("process_frame", callable);
+	}
+
+	// Release both the current and retired snapshots.
+	_publish(nullptr);
+	_publish(nullptr);
+}
+
+void attach_to(sentry_value_t p_event) {
+	const Snapshot *snapshot = current_snapshot.load();
+	if (snapshot == nullptr) {
+		return;
+	}
+
+	sentry_value_t contexts = sentry_value_get_by_key(p_event, "contexts");
+	if (sentry_value_is_null(contexts)) {
+		contexts = sentry_value_new_object();
+		sentry_value_set_by_key(p_event, "contexts", contexts);
+	}
+
+	for (const Context &ctx : snapshot->contexts) {
+		sentry_value_t target = sentry_value_get_by_key(contexts, ctx.name.get_data());
+		if (sentry_value_is_null(target)) {
+			target = sentry_value_new_object();
+			sentry_value_set_by_key(contexts, ctx.name.get_data(), target);
+		}
+		for (const Field &field : ctx.fields) {
+			sentry_value_incref(field.value); // snapshot keeps its own reference
+			sentry_value_set_by_key(target, field.key.get_data(), field.value);
+		}
+	}
+}
+
+void attach_thread_locations(sentry_value_t p_event) {
+	sentry_value_t threads = sentry_value_new_object();
+	bool any = false;
+
+	sentry::thread_locations::Record record;
+	for (int i = 0; i < sentry::thread_locations::MAX_SLOTS; i++) {
+		if (!sentry::thread_locations::read_slot(i, record)) {
+			continue;
+		}
+
+		sentry_value_t entry = sentry_value_new_object();
+		if (record.file[0]) {
+			sentry_value_set_by_key(entry, "file", sentry_value_new_string(record.file));
+			sentry_value_set_by_key(entry, "function", sentry_value_new_string(record.function));
+			sentry_value_set_by_key(entry, "line", sentry_value_new_int32(record.line));
+		}
+		if (record.scene[0]) {
+			sentry_value_set_by_key(entry, "scene", sentry_value_new_string(record.scene));
+		}
+
+		char key[sentry::thread_locations::LABEL_SIZE + 32];
+		if (record.label[0]) {
+			snprintf(key, sizeof(key), "%s (%" PRIu64 ")", record.label, record.thread_id);
+		} else {
+			snprintf(key, sizeof(key), "thread %" PRIu64, record.thread_id);
+		}
+		sentry_value_set_by_key(threads, key, entry);
+		any = true;
+	}
+
+	if (!any) {
+		sentry_value_decref(threads);
+		return;
+	}
+
+	sentry_value_t contexts = sentry_value_get_by_key(p_event, "contexts");
+	if (sentry_value_is_null(contexts)) {
+		contexts = sentry_value_new_object();
+		sentry_value_set_by_key(p_event, "contexts", contexts);
+	}
+	sentry_value_set_by_key(contexts, "godot_threads", threads);
+}
+
+} //namespace sentry::native::crash_context
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <sentry.h>
+
+namespace sentry::native::crash_context {
+
+// Event contexts for crash reports are prepared ahead of time on the main thread,
+// so that the crash handler only needs to attach them. Gathering them at crash time means
+// querying engine singletons and allocating Variants, which isn't safe in a crashed process.
+
+// Rebuilds the snapshot from current engine state. Must be called on the main thread.
+void refresh();
+
+// Starts/stops refreshing the snapshot periodically on the main loop.
+void start_refreshing();
+void stop_refreshing();
+
+// Merges the latest snapshot into the event contexts. Intended for the crash handler:
+// takes no locks and doesn't touch engine objects.
+void attach_to(sentry_value_t p_event);
+
+// Adds "godot_threads" context with per-thread script locations (see thread_locations.h).
+// Same constraints as attach_to().
+void attach_thread_locations(sentry_value_t p_event);
+
+} //namespace sentry::native::crash_context
@@ -78,8 +78,9 @@ String NativeEvent::get_message() const {
 }
 
 void NativeEvent::set_timestamp(const Ref<SentryTimestamp> &p_timestamp) {
-	if (p_timestamp.is_valid()) {
-		_sentry_value_set_or_remove_string_by_key(native_event, "timestamp", p_timestamp->to_rfc3339());
+	char buffer[SentryTimestamp::RFC3339_BUFFER_SIZE];
+	if (p_timestamp.is_valid() && SentryTimestamp::format_rfc3339(p_timestamp->get_microseconds_since_unix_epoch(), buffer)) {
+		sentry_value_set_by_key(native_event, "timestamp", sentry_value_new_string(buffer));
 	} else {
 		sentry_value_remove_by_key(native_event, "timestamp");
 	}
@@ -0,0 +1,269 @@
+#include "native_journal.h"
+
+#include "sentry/logging/print.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+#ifdef WINDOWS_ENABLED
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using Recovered = sentry::native::journal::Recovered;
+using EntryType = sentry::native::journal::EntryType;
+
+constexpr char MAGIC[8] = { 'S', 'G', 'J', 'R', 'N', 'L', '\0', '\0' };
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t SLOT_COUNT = 256;
+constexpr uint32_t SLOT_DATA_SIZE = 232;
+constexpr uint32_t CONTEXT_CAPACITY = 16'384;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+struct Header {
+	char magic[8];
+	uint32_t version;
+	uint32_t slot_count;
+	std::atomic<uint64_t> next_sequence;
+	std::atomic<uint32_t> crashed;
+	// Zero while the snapshot is being replaced.
+	std::atomic<uint32_t> context_length;
+	uint8_t reserved[32];
+};
+
+struct Slot {
+	// Zero while the slot is being written.
+	std::atomic<uint64_t> sequence;
+	int64_t timestamp_usec;
+	uint8_t type;
+	uint8_t level;
+	uint16_t key_length;
+	uint16_t value_length;
+	uint16_t reserved;
+	char data[SLOT_DATA_SIZE];
+};
+
+static_assert(sizeof(Header) == 64);
+static_assert(sizeof(Slot) == 256);
+
+constexpr size_t FILE_SIZE = sizeof(Header) + sizeof(Slot) * SLOT_COUNT + CONTEXT_CAPACITY;
+
+uint8_t *mapping = nullptr;
+
+#ifdef WINDOWS_ENABLED
+HANDLE file_handle = INVALID_HANDLE_VALUE;
+HANDLE mapping_handle = nullptr;
+#else
+int file_descriptor = -1;
+#endif
+
+_FORCE_INLINE_ Header *_header() { return reinterpret_cast<Header *>(mapping); }
+_FORCE_INLINE_ Slot *_slots() { return reinterpret_cast<Slot *>(mapping + sizeof(Header)); }
+_FORCE_INLINE_ char *_context() { return reinterpret_cast<char *>(mapping + sizeof(Header) + sizeof(Slot) * SLOT_COUNT); }
+
+bool _map_file(const String &p_path) {
+#ifdef WINDOWS_ENABLED
+	file_handle = CreateFileW((LPCWSTR)p_path.utf16().get_data(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+			nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file_handle == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READWRITE, 0, (DWORD)FILE_SIZE, nullptr);
+	if (mapping_handle == nullptr) {
+		CloseHandle(file_handle);
+		file_handle = INVALID_HANDLE_VALUE;
+		return false;
+	}
+	mapping = (uint8_t *)MapViewOfFile(mapping_handle, FILE_MAP_ALL_ACCESS, 0, 0, FILE_SIZE);
+	if (mapping == nullptr) {
+		CloseHandle(mapping_handle);
+		CloseHandle(file_handle);
+		mapping_handle = nullptr;
+		file_handle = INVALID_HANDLE_VALUE;
+		return false;
+	}
+#else
+	file_descriptor = ::open(p_path.utf8().get_data(), O_RDWR | O_CREAT, 0600);
+	if (file_descriptor < 0) {
+		return false;
+	}
+	if (ftruncate(file_descriptor, FILE_SIZE) != 0) {
+		::close(file_descriptor);
+		file_descriptor = -1;
+		return false;
+	}
+	void *ptr = mmap(nullptr, FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+	if (ptr == MAP_FAILED) {
+		::close(file_descriptor);
+		file_descriptor = -1;
+		return false;
+	}
+	mapping = (uint8_t *)ptr;
+#endif
+	return true;
+}
+
+void _unmap_file() {
+#ifdef WINDOWS_ENABLED
+	UnmapViewOfFile(mapping);
+	CloseHandle(mapping_handle);
+	CloseHandle(file_handle);
+	mapping_handle = nullptr;
+	file_handle = INVALID_HANDLE_VALUE;
+#else
+	munmap(mapping, FILE_SIZE);
+	::close(file_descriptor);
+	file_descriptor = -1;
+#endif
+	mapping = nullptr;
+}
+
+void _recover(Recovered &r_previous) {
+	const Header *header = _header();
+	if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION || header->slot_count != SLOT_COUNT) {
+		return;
+	}
+
+	r_previous.valid = true;
+	r_previous.crashed = header->crashed.load() != 0;
+
+	const Slot *slots = _slots();
+	for (uint32_t i = 0; i < SLOT_COUNT; i++) {
+		const Slot &slot = slots[i];
+		uint64_t sequence = slot.sequence.load();
+		if (sequence == 0 || slot.key_length + slot.value_length > SLOT_DATA_SIZE) {
+			continue;
+		}
+		Recovered::Entry entry;
+		entry.sequence = sequence;
+		entry.timestamp_usec = slot.timestamp_usec;
+		entry.type = (EntryType)slot.type;
+		entry.level = sentry::int_to_level(slot.level);
+		entry.key = String::utf8(slot.data, slot.key_length);
+		entry.value = String::utf8(slot.data + slot.key_length, slot.value_length);
+		r_previous.entries.push_back(entry);
+	}
+	r_previous.entries.sort();
+
+	uint32_t context_length = header->context_length.load();
+	if (context_length > 0 && context_length <= CONTEXT_CAPACITY) {
+		r_previous.context_json = String::utf8(_context(), context_length);
+	}
+}
+
+void _reset() {
+	memset(mapping, 0, FILE_SIZE);
+	Header *header = _header();
+	memcpy(header->magic, MAGIC, sizeof(MAGIC));
+	header->version = VERSION;
+	header->slot_count = SLOT_COUNT;
+	header->next_sequence.store(1);
+}
+
+// Copies as much of p_src as fits into p_dest, respecting UTF-8 character boundaries.
+uint16_t _copy_truncated(char *p_dest, size_t p_capacity, const CharString &p_src) {
+	size_t length = p_src.length();
+	if (length > p_capacity) {
+		length = p_capacity;
+		while (length > 0 && (p_src[length] & 0xC0) == 0x80) {
+			length--;
+		}
+	}
+	memcpy(p_dest, p_src.get_data(), length);
+	return (uint16_t)length;
+}
+
+void _write_entry(EntryType p_type, sentry::Level p_level, const String &p_key, const String &p_value) {
+	if (mapping == nullptr) {
+		return;
+	}
+
+	CharString key = p_key.utf8();
+	CharString value = p_value.utf8();
+
+	Header *header = _header();
+	uint64_t sequence = header->next_sequence.fetch_add(1, std::memory_order_relaxed);
+	Slot &slot = _slots()[sequence % SLOT_COUNT];
+
+	slot.sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot.timestamp_usec = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::system_clock::now().time_since_epoch())
+								  .count();
+	slot.type = p_type;
+	slot.level = (uint8_t)p_level;
+	slot.key_length = _copy_truncated(slot.data, SLOT_DATA_SIZE / 4, key);
+	slot.value_length = _copy_truncated(slot.data + slot.key_length, SLOT_DATA_SIZE - slot.key_length, value);
+
+	slot.sequence.store(sequence, std::memory_order_release);
+}
+
+} // unnamed namespace
+
+namespace sentry::native::journal {
+
+bool open(const String &p_path, Recovered &r_previous) {
+	ERR_FAIL_COND_V(mapping != nullptr, false);
+
+	if (!_map_file(p_path)) {
+		sentry::logging::print_error("Failed to map journal file: ", p_path);
+		return false;
+	}
+
+	_recover(r_previous);
+	_reset();
+
+	sentry::logging::print_debug("Journal opened: ", p_path);
+	return true;
+}
+
+void close() {
+	if (mapping) {
+		_unmap_file();
+	}
+}
+
+bool is_open() {
+	return mapping != nullptr;
+}
+
+void add_breadcrumb(const String &p_category, const String &p_message, sentry::Level p_level) {
+	_write_entry(ENTRY_BREADCRUMB, p_level, p_category, p_message);
+}
+
+void add_tag(const String &p_key, const String &p_value) {
+	_write_entry(ENTRY_TAG, sentry::LEVEL_INFO, p_key, p_value);
+}
+
+void set_context_snapshot(const CharString &p_json) {
+	if (mapping == nullptr) {
+		return;
+	}
+	if ((size_t)p_json.length() > CONTEXT_CAPACITY) {
+		sentry::logging::print_debug("Journal: context snapshot is too large - skipping");
+		return;
+	}
+
+	Header *header = _header();
+	header->context_length.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	memcpy(_context(), p_json.get_data(), p_json.length());
+	header->context_length.store((uint32_t)p_json.length(), std::memory_order_release);
+}
+
+void mark_crashed() {
+	if (mapping) {
+		_header()->crashed.store(1, std::memory_order_relaxed);
+	}
+}
+
+} //namespace sentry::native::journal
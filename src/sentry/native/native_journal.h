@@ -0,0 +1,54 @@
+#pragma once
+
+#include "sentry/level.h"
+
+#include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+using namespace godot;
+
+// Journal of breadcrumbs, tags and contexts kept in a memory-mapped file, so that it survives
+// when the process is killed without a chance to run the crash handler (SIGKILL, OOM killer).
+// Writes are plain stores into mapped memory -- no system calls per entry.
+namespace sentry::native::journal {
+
+enum EntryType : uint8_t {
+	ENTRY_BREADCRUMB = 1,
+	ENTRY_TAG = 2,
+};
+
+// Journal contents recovered from the previous session.
+struct Recovered {
+	struct Entry {
+		uint64_t sequence = 0;
+		int64_t timestamp_usec = 0;
+		EntryType type = ENTRY_BREADCRUMB;
+		sentry::Level level = sentry::LEVEL_INFO;
+		String key; // breadcrumb category or tag key
+		String value; // breadcrumb message or tag value
+
+		bool operator<(const Entry &p_other) const { return sequence < p_other.sequence; }
+	};
+
+	bool valid = false;
+	bool crashed = false;
+	Vector<Entry> entries; // ordered from oldest to newest
+	String context_json;
+};
+
+// Maps journal file, recovering contents left by the previous session into r_previous.
+bool open(const String &p_path, Recovered &r_previous);
+void close();
+bool is_open();
+
+void add_breadcrumb(const String &p_category, const String &p_message, sentry::Level p_level);
+void add_tag(const String &p_key, const String &p_value);
+
+// Replaces stored context snapshot (JSON). Main thread only.
+void set_context_snapshot(const CharString &p_json);
+
+// Flags the session as crashed, so that it's not reported again as abnormal termination.
+// Safe to call from a crash handler.
+void mark_crashed();
+
+} //namespace sentry::native::journal
@@ -5,29 +5,80 @@
 #include "sentry/level.h"
 #include "sentry/logging/print.h"
 #include "sentry/native/native_breadcrumb.h"
+#include "sentry/native/native_breadcrumb_buffer.h"
+#include "sentry/native/native_crash_context.h"
 #include "sentry/native/native_event.h"
+#include "sentry/native/native_journal.h"
 #include "sentry/native/native_log.h"
+#include "sentry/native/native_transaction.h"
+#include "sentry/native/native_transport.h"
 #include "sentry/native/native_util.h"
+#include "sentry/options_snapshot.h"
 #include "sentry/processing/process_event.h"
 #include "sentry/processing/process_log.h"
+#include "sentry/sampling.h"
 #include "sentry/sentry_attachment.h"
 #include "sentry/sentry_sdk.h"
+#include "sentry/sentry_timestamp.h"
 #include "sentry/util/screenshot.h"
+#include "sentry/uuid.h"
 
 #include <cstdio>
+#include <godot_cpp/classes/dir_access.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/json.hpp>
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
 
 namespace {
 
 using NativeEvent = sentry::native::NativeEvent;
 using NativeLog = sentry::native::NativeLog;
 
+// Set while capturing an event whose in-memory attachments were already produced on this thread.
+// Otherwise, attachments are produced in the before_send hook as files, since sentry-native has
+// already collected per-event attachments by then.
+thread_local bool attachments_processed = false;
+
+// Set while capturing an event that describes the previous session. Such events are treated
+// like crash reports: they are not enriched with current state and get no attachments.
+thread_local bool previous_session_event = false;
+
+// Cached at init so that the crash handler doesn't need to access options.
+bool minimal_crash_handling = false;
+
+// Random roll in [0, 1) for sampling a crash in this session, drawn ahead of time since seeding
+// a random generator isn't safe in a crashed process. Compared against the current sample rate.
+double crash_sample_roll = 0.0;
+
+// Limits calls queued while the SDK is starting in the background.
+constexpr uint32_t MAX_PENDING_CALLS = 500;
+
+// Set on the main thread while queued calls are replayed, so that they are not queued again.
+thread_local bool replaying_pending_calls = false;
+
+// SDK that is starting in the background. Main thread only.
+sentry::native::NativeSDK *starting_sdk = nullptr;
+
+void _finish_starting_sdk() {
+	if (starting_sdk) {
+		starting_sdk->finish_init();
+	}
+}
+
 sentry_value_t _handle_before_send(sentry_value_t event, void *hint, void *closure) {
-	Ref<NativeEvent> event_obj = memnew(NativeEvent(event, false));
-	Ref<NativeEvent> processed = sentry::process_event(event_obj);
+	if (!previous_session_event) {
+		sentry::native::breadcrumbs::attach_to(event, false);
+	}
+
+	Ref<NativeEvent> event_obj = memnew(NativeEvent(event, previous_session_event));
+	sentry::AttachmentProduction attachments = previous_session_event
+			? sentry::PRODUCE_NO_ATTACHMENTS
+			: (attachments_processed ? sentry::PRODUCE_DEFERRED_ATTACHMENTS : sentry::PRODUCE_FILE_ATTACHMENTS);
+	Ref<NativeEvent> processed = sentry::process_event(event_obj, attachments);
 
 	if (unlikely(processed.is_null())) {
 		// Discard event.
@@ -52,6 +103,25 @@ sentry_value_t _handle_before_send_log(sentry_value_t p_value, void *p_user_data
 }
 
 sentry_value_t _handle_on_crash(const sentry_ucontext_t *uctx, sentry_value_t event, void *closure) {
+	// The session ended in a crash -- don't report it as abnormal termination on the next launch,
+	// even if the crash itself is sampled out.
+	sentry::native::journal::mark_crashed();
+
+	if (crash_sample_roll >= sentry::options_snapshot::get()->sample_rate) {
+		sentry_value_decref(event);
+		return sentry_value_new_null();
+	}
+
+	// Attach contexts prepared ahead of time -- gathering them now isn't safe in a crashed process.
+	sentry::native::crash_context::attach_to(event);
+	sentry::native::crash_context::attach_thread_locations(event);
+	sentry::native::breadcrumbs::attach_to(event, true, !minimal_crash_handling);
+
+	if (minimal_crash_handling) {
+		// Skip event processors and script callbacks.
+		return event;
+	}
+
 	Ref<NativeEvent> event_obj = memnew(NativeEvent(event, true));
 	Ref<NativeEvent> processed = sentry::process_event(event_obj);
 
@@ -135,31 +205,160 @@ inline String _uuid_as_string(sentry_uuid_t p_uuid) {
 	return str;
 }
 
+// Creates local scope carrying in-memory attachments produced for a single event.
+// Returns nullptr if there is nothing to attach.
+sentry_scope_t *_make_attachments_scope(const Vector<Ref<sentry::SentryAttachment>> &p_attachments) {
+	if (p_attachments.is_empty()) {
+		return nullptr;
+	}
+
+	sentry_scope_t *scope = sentry_local_scope_new();
+	for (const Ref<sentry::SentryAttachment> &att : p_attachments) {
+		const PackedByteArray &bytes = att->get_bytes();
+		if (bytes.is_empty()) {
+			continue;
+		}
+		sentry_attachment_t *native_attachment = sentry_scope_attach_bytes(scope,
+				reinterpret_cast<const char *>(bytes.ptr()),
+				bytes.size(),
+				att->get_filename().utf8());
+		ERR_CONTINUE_MSG(native_attachment == nullptr, "Sentry: Failed to attach bytes with filename: " + att->get_filename());
+		sentry_attachment_set_content_type(native_attachment, att->get_content_type_or_default().utf8());
+	}
+	return scope;
+}
+
+// Returns ID of the event, assigning one if missing, so that it's known before the event is captured.
+String _ensure_event_id(sentry_value_t p_event) {
+	String id = sentry_value_as_string(sentry_value_get_by_key(p_event, "event_id"));
+	if (id.is_empty()) {
+		id = sentry::uuid::make_uuid();
+		sentry_value_set_by_key(p_event, "event_id", sentry_value_new_string(id.utf8()));
+	}
+	return id;
+}
+
+inline sentry_value_t _timestamp_value(int64_t p_usec) {
+	char buffer[sentry::SentryTimestamp::RFC3339_BUFFER_SIZE];
+	if (!sentry::SentryTimestamp::format_rfc3339(p_usec, buffer)) {
+		return sentry_value_new_null();
+	}
+	return sentry_value_new_string(buffer);
+}
+
+// Reports previous session that ended without shutting down the SDK and without a crash report,
+// e.g., killed by the OS due to low memory. Breadcrumbs, tags and contexts come from the journal.
+void _capture_abnormal_termination(const sentry::native::journal::Recovered &p_previous) {
+	using Entry = sentry::native::journal::Recovered::Entry;
+
+	if (!sentry::sampling::sample_event()) {
+		sentry::logging::print_debug("Abnormal termination event sampled out");
+		return;
+	}
+
+	sentry_value_t event = sentry_value_new_message_event(SENTRY_LEVEL_FATAL, "",
+			"Abnormal termination: the previous session ended without shutting down");
+
+	sentry_value_t breadcrumbs = sentry_value_new_list();
+	sentry_value_t tags = sentry_value_new_object();
+	int64_t last_timestamp_usec = 0;
+
+	for (const Entry &entry : p_previous.entries) {
+		if (entry.type == sentry::native::journal::ENTRY_TAG) {
+			sentry_value_set_by_key(tags, entry.key.utf8(), sentry_value_new_string(entry.value.utf8()));
+			continue;
+		}
+		sentry_value_t crumb = sentry_value_new_breadcrumb(nullptr, entry.value.utf8());
+		if (!entry.key.is_empty()) {
+			sentry_value_set_by_key(crumb, "category", sentry_value_new_string(entry.key.utf8()));
+		}
+		sentry_value_set_by_key(crumb, "level", sentry_value_new_string(sentry::level_as_cstring(entry.level)));
+		sentry_value_set_by_key(crumb, "timestamp", _timestamp_value(entry.timestamp_usec));
+		sentry_value_append(breadcrumbs, crumb);
+		last_timestamp_usec = entry.timestamp_usec;
+	}
+
+	sentry_value_set_by_key(event, "breadcrumbs", breadcrumbs);
+	sentry_value_set_by_key(event, "tags", tags);
+
+	if (last_timestamp_usec > 0) {
+		// Best approximation of when the session ended.
+		sentry_value_set_by_key(event, "timestamp", _timestamp_value(last_timestamp_usec));
+	}
+
+	if (!p_previous.context_json.is_empty()) {
+		Variant contexts = JSON::parse_string(p_previous.context_json);
+		if (contexts.get_type() == Variant::DICTIONARY) {
+			sentry_value_set_by_key(event, "contexts", sentry::native::variant_to_sentry_value(contexts));
+		}
+	}
+
+	sentry::logging::print_debug("Reporting abnormal termination of the previous session");
+
+	previous_session_event = true;
+	sentry_capture_event(event);
+	previous_session_event = false;
+}
+
 } // unnamed namespace
 
 namespace sentry::native {
 
+bool NativeSDK::_is_starting() const {
+	return unlikely(state.load(std::memory_order_acquire) == STATE_STARTING) && !replaying_pending_calls;
+}
+
+bool NativeSDK::_defer(std::function<void()> &&p_call) {
+	std::lock_guard lock(pending_mutex);
+	if (state.load(std::memory_order_relaxed) != STATE_STARTING) {
+		// Finished in the meantime.
+		return false;
+	}
+	if (pending_calls.size() >= MAX_PENDING_CALLS) {
+		pending_dropped++;
+	} else {
+		pending_calls.push_back(std::move(p_call));
+	}
+	return true;
+}
+
 void NativeSDK::set_context(const String &p_key, const Dictionary &p_value) {
 	ERR_FAIL_COND(p_key.is_empty());
+	if (_is_starting() && _defer([this, p_key, p_value]() { set_context(p_key, p_value); })) {
+		return;
+	}
 	sentry_set_context(p_key.utf8(), sentry::native::variant_to_sentry_value(p_value));
 }
 
 void NativeSDK::remove_context(const String &p_key) {
 	ERR_FAIL_COND(p_key.is_empty());
+	if (_is_starting() && _defer([this, p_key]() { remove_context(p_key); })) {
+		return;
+	}
 	sentry_remove_context(p_key.utf8());
 }
 
 void NativeSDK::set_tag(const String &p_key, const String &p_value) {
 	ERR_FAIL_COND(p_key.is_empty());
+	if (_is_starting() && _defer([this, p_key, p_value]() { set_tag(p_key, p_value); })) {
+		return;
+	}
 	sentry_set_tag(p_key.utf8(), p_value.utf8());
+	sentry::native::journal::add_tag(p_key, p_value);
 }
 
 void NativeSDK::remove_tag(const String &p_key) {
 	ERR_FAIL_COND(p_key.is_empty());
+	if (_is_starting() && _defer([this, p_key]() { remove_tag(p_key); })) {
+		return;
+	}
 	sentry_remove_tag(p_key.utf8());
 }
 
 void NativeSDK::set_user(const Ref<SentryUser> &p_user) {
+	if (_is_starting() && _defer([this, p_user]() { set_user(p_user); })) {
+		return;
+	}
 	if (p_user.is_valid()) {
 		sentry_value_t user_data = sentry_value_new_object();
 
@@ -186,6 +385,9 @@ void NativeSDK::set_user(const Ref<SentryUser> &p_user) {
 }
 
 void NativeSDK::remove_user() {
+	if (_is_starting() && _defer([this]() { remove_user(); })) {
+		return;
+	}
 	sentry_remove_user();
 }
 
@@ -197,15 +399,23 @@ void NativeSDK::add_breadcrumb(const Ref<SentryBreadcrumb> &p_breadcrumb) {
 	ERR_FAIL_COND_MSG(p_breadcrumb.is_null(), "Sentry: Can't add breadcrumb - breadcrumb object is null.");
 	NativeBreadcrumb *crumb = Object::cast_to<NativeBreadcrumb>(p_breadcrumb.ptr());
 	ERR_FAIL_NULL(crumb);
-	sentry_value_t native_crumb = crumb->get_native_breadcrumb();
-	sentry_value_incref(native_crumb); // give ownership to native
-	sentry_add_breadcrumb(native_crumb);
+	if (_is_starting() && _defer([this, p_breadcrumb]() { add_breadcrumb(p_breadcrumb); })) {
+		return;
+	}
+	// Stored in compact form -- converted to native values only when an event is captured.
+	sentry::native::breadcrumbs::add(crumb->get_record());
+	if (sentry::native::journal::is_open()) {
+		sentry::native::journal::add_breadcrumb(crumb->get_category(), crumb->get_message(), crumb->get_level());
+	}
 }
 
 void NativeSDK::log(LogLevel p_level, const String &p_body, const Dictionary &p_attributes) {
 	if (p_body.is_empty()) {
 		return;
 	}
+	if (_is_starting() && _defer([this, p_level, p_body, p_attributes]() { log(p_level, p_body, p_attributes); })) {
+		return;
+	}
 
 	String body = p_body;
 
@@ -251,13 +461,9 @@ String NativeSDK::capture_message(const String &p_message, Level p_level) {
 			"", // logger
 			p_message.utf8().get_data());
 
-	sentry_uuid_t uuid = sentry_capture_event(event);
-
-	last_uuid_mutex->lock();
-	last_uuid = uuid;
-	last_uuid_mutex->unlock();
-
-	return _uuid_as_string(uuid);
+	Ref<NativeEvent> event_obj = memnew(NativeEvent(event, false));
+	sentry_value_decref(event); // event_obj holds the reference now
+	return capture_event(event_obj);
 }
 
 String NativeSDK::get_last_event_id() {
@@ -278,9 +484,33 @@ String NativeSDK::capture_event(const Ref<SentryEvent> &p_event) {
 	ERR_FAIL_COND_V_MSG(p_event.is_null(), _uuid_as_string(sentry_uuid_nil()), "Sentry: Can't capture event - event object is null.");
 	NativeEvent *native_event = Object::cast_to<NativeEvent>(p_event.ptr());
 	ERR_FAIL_NULL_V(native_event, _uuid_as_string(sentry_uuid_nil())); // Sanity check - this should never happen.
+
+	if (_is_starting()) {
+		String id = _ensure_event_id(native_event->get_native_value());
+		if (_defer([this, p_event]() { capture_event(p_event); })) {
+			last_uuid_mutex->lock();
+			last_uuid = sentry_uuid_from_string(id.utf8());
+			last_uuid_mutex->unlock();
+			return id;
+		}
+	}
+
+	// sentry-native collects per-event attachments before invoking the before_send hook.
+	// If nothing can discard the event, produce in-memory attachments (screenshot) up front.
+	// Otherwise, all attachments are produced as files after the event is accepted.
+	sentry_scope_t *attachments_scope = nullptr;
+	bool produce_up_front = !sentry::has_event_filters();
+	if (produce_up_front) {
+		sentry::process_event_attachments(p_event);
+		attachments_scope = _make_attachments_scope(p_event->get_attachments());
+	}
+
 	sentry_value_t event = native_event->get_native_value();
 	sentry_value_incref(event); // Keep ownership.
-	sentry_uuid_t uuid = sentry_capture_event(event);
+
+	attachments_processed = produce_up_front;
+	sentry_uuid_t uuid = attachments_scope ? sentry_capture_event_with_scope(event, attachments_scope) : sentry_capture_event(event);
+	attachments_processed = false;
 
 	last_uuid_mutex->lock();
 	last_uuid = uuid;
@@ -292,6 +522,9 @@ String NativeSDK::capture_event(const Ref<SentryEvent> &p_event) {
 void NativeSDK::capture_feedback(const Ref<SentryFeedback> &p_feedback) {
 	ERR_FAIL_COND_MSG(p_feedback.is_null(), "Sentry: Can't capture feedback - feedback object is null.");
 	ERR_FAIL_COND_MSG(p_feedback->get_message().is_empty(), "Sentry: Can't capture feedback - feedback message is empty.");
+	if (_is_starting() && _defer([this, p_feedback]() { capture_feedback(p_feedback); })) {
+		return;
+	}
 
 	sentry_value_t feedback = sentry_value_new_object();
 
@@ -317,6 +550,9 @@ void NativeSDK::capture_feedback(const Ref<SentryFeedback> &p_feedback) {
 void NativeSDK::add_attachment(const Ref<SentryAttachment> &p_attachment) {
 	ERR_FAIL_COND_MSG(p_attachment.is_null(), "Sentry: Can't add null attachment.");
 	ERR_FAIL_NULL(ProjectSettings::get_singleton());
+	if (_is_starting() && _defer([this, p_attachment]() { add_attachment(p_attachment); })) {
+		return;
+	}
 
 	sentry_attachment_t *native_attachment = nullptr;
 
@@ -353,12 +589,34 @@ void NativeSDK::add_attachment(const Ref<SentryAttachment> &p_attachment) {
 	}
 }
 
+Ref<SentryTransaction> NativeSDK::start_transaction(const String &p_name, const String &p_operation, int64_t p_start_timestamp_usec) {
+	if (_is_starting()) {
+		// Transactions can't be recorded until sentry-native is ready.
+		return Ref<SentryTransaction>();
+	}
+	sentry_transaction_context_t *context = sentry_transaction_context_new(p_name.utf8(), p_operation.utf8());
+	ERR_FAIL_NULL_V(context, Ref<SentryTransaction>());
+	sentry_transaction_t *native_transaction = p_start_timestamp_usec > 0
+			? sentry_transaction_start_ts(context, sentry_value_new_null(), (uint64_t)p_start_timestamp_usec)
+			: sentry_transaction_start(context, sentry_value_new_null());
+	return memnew(NativeTransaction(native_transaction, p_name));
+}
+
+bool NativeSDK::flush(int p_timeout_ms) {
+	if (state.load() != STATE_READY) {
+		// Calls queued while starting are not captured yet.
+		return false;
+	}
+	return sentry_flush((uint64_t)MAX(0, p_timeout_ms)) == 0;
+}
+
 void NativeSDK::init(const PackedStringArray &p_global_attachments, const Callable &p_configuration_callback) {
 	ERR_FAIL_NULL(OS::get_singleton());
 	ERR_FAIL_NULL(ProjectSettings::get_singleton());
 
 	if (p_configuration_callback.is_valid()) {
 		p_configuration_callback.call(SENTRY_OPTIONS());
+		sentry::options_snapshot::publish(SENTRY_OPTIONS().ptr());
 	}
 
 	sentry_options_t *options = sentry_options_new();
@@ -369,11 +627,19 @@ void NativeSDK::init(const PackedStringArray &p_global_attachments, const Callab
 	sentry_options_set_release(options, SENTRY_OPTIONS()->get_release().utf8());
 	sentry_options_set_dist(options, SENTRY_OPTIONS()->get_dist().utf8());
 	sentry_options_set_environment(options, SENTRY_OPTIONS()->get_environment().utf8());
-	sentry_options_set_sample_rate(options, SENTRY_OPTIONS()->get_sample_rate());
+	// Error events are sampled by the SDK before they are built (see sampling.h).
+	sentry_options_set_sample_rate(options, 1.0);
+	// Transactions are sampled by the SDK before they are started (see SentrySDK::start_transaction()).
+	sentry_options_set_traces_sample_rate(options, 1.0);
 	sentry_options_set_max_breadcrumbs(options, SENTRY_OPTIONS()->get_max_breadcrumbs());
+	sentry::native::breadcrumbs::set_capacity(SENTRY_OPTIONS()->get_max_breadcrumbs());
 	sentry_options_set_sdk_name(options, "sentry.native.godot");
 	sentry_options_set_logger_enabled_when_crashed(options, false);
 	sentry_options_set_enable_logs(options, SENTRY_OPTIONS()->get_enable_logs());
+	// Envelopes still queued after the timeout are written to disk, and sent on the next launch.
+	sentry_options_set_shutdown_timeout(options, SENTRY_OPTIONS()->is_persist_on_shutdown_enabled()
+					? 0
+					: (uint64_t)SENTRY_OPTIONS()->get_shutdown_timeout_ms());
 
 	// Establish handler path.
 	String handler_fn;
@@ -417,6 +683,20 @@ void NativeSDK::init(const PackedStringArray &p_global_attachments, const Callab
 
 	sentry_options_set_logs_with_attributes(options, true);
 
+	if (SENTRY_OPTIONS()->get_transport().is_valid()) {
+		sentry_options_set_transport(options, sentry::native::transport::create_custom(SENTRY_OPTIONS()->get_transport()));
+	} else if (SENTRY_OPTIONS()->is_transport_spooling_enabled()) {
+		sentry::native::transport::Config transport_config;
+		transport_config.outbox_dir = OS::get_singleton()->get_user_data_dir() + "/sentry/outbox";
+		transport_config.max_queued = SENTRY_OPTIONS()->get_transport_queue_size();
+		transport_config.workers = SENTRY_OPTIONS()->get_transport_workers();
+		transport_config.compression = SENTRY_OPTIONS()->get_envelope_compression();
+		transport_config.compression_threshold = SENTRY_OPTIONS()->get_envelope_compression_threshold();
+		transport_config.session_budget_bytes = SENTRY_OPTIONS()->get_transport_session_budget_kb() * 1024LL;
+		transport_config.hourly_budget_bytes = SENTRY_OPTIONS()->get_transport_hourly_budget_kb() * 1024LL;
+		sentry_options_set_transport(options, sentry::native::transport::create(transport_config));
+	}
+
 	// Hooks.
 	sentry_options_set_before_send(options, _handle_before_send, NULL);
 	sentry_options_set_on_crash(options, _handle_on_crash, NULL);
@@ -427,19 +707,125 @@ void NativeSDK::init(const PackedStringArray &p_global_attachments, const Callab
 		sentry_options_set_before_send_log(options, _handle_before_send_log, NULL);
 	}
 
-	int err = sentry_init(options);
-	initialized = (err == 0);
+	minimal_crash_handling = SENTRY_OPTIONS()->is_minimal_crash_handling_enabled();
+	crash_sample_roll = sentry::sampling::roll();
+
+	// Map the journal before init: it holds what is left of the previous session.
+	previous_session = sentry::native::journal::Recovered();
+	Ref<RuntimeConfig> runtime_config = SentrySDK::get_singleton()->get_runtime_config();
+	if (SENTRY_OPTIONS()->is_journal_enabled() && runtime_config.is_valid()) {
+		String journal_path = OS::get_singleton()->get_user_data_dir() + "/sentry/journal.bin";
+		DirAccess::make_dir_recursive_absolute(journal_path.get_base_dir());
+		sentry::native::journal::open(journal_path, previous_session);
+	}
+
+	init_start_usec = Time::get_singleton()->get_ticks_usec();
+	pending_dropped = 0;
+	state = STATE_STARTING;
+
+	if (SENTRY_OPTIONS()->is_async_init_enabled()) {
+		// Launching the crash handler and scanning the database takes a while -- don't block the main thread.
+		sentry::logging::print_debug("Starting native SDK in the background");
+		starting_sdk = this;
+		init_thread = std::thread([this, options]() {
+			init_result = sentry_init(options);
+			callable_mp_static(&_finish_starting_sdk).call_deferred();
+		});
+	} else {
+		_on_started(sentry_init(options), false);
+	}
+}
+
+void NativeSDK::finish_init() {
+	if (state.load() != STATE_STARTING || !init_thread.joinable()) {
+		return;
+	}
+	init_thread.join();
+	if (starting_sdk == this) {
+		starting_sdk = nullptr;
+	}
+	_on_started(init_result, true);
+}
+
+void NativeSDK::_on_started(int p_result, bool p_async) {
+	replaying_pending_calls = true;
+
+	if (p_result == 0) {
+		sentry::logging::print_debug(vformat("Native SDK started in %d ms",
+				(Time::get_singleton()->get_ticks_usec() - init_start_usec) / 1000));
 
-	if (is_enabled()) {
 		set_user(SentryUser::create_default());
+		sentry::native::crash_context::start_refreshing();
+
+		Ref<RuntimeConfig> runtime_config = SentrySDK::get_singleton()->get_runtime_config();
+		if (sentry::native::journal::is_open() && runtime_config.is_valid()) {
+			// The journal only records crashes seen by our on_crash hook. Crashes captured by the
+			// crash handler without it are known to sentry-native, and already reported.
+			if (runtime_config->is_session_active() && previous_session.valid && !previous_session.crashed &&
+					sentry_get_crashed_last_run() != 1) {
+				_capture_abnormal_termination(previous_session);
+			}
+			runtime_config->set_session_active(true);
+		}
+
+		// Replay calls made while starting. More may be queued by other threads meanwhile, so repeat until
+		// none are left, and only then let calls through.
+		while (true) {
+			std::vector<std::function<void()>> calls;
+			{
+				std::lock_guard lock(pending_mutex);
+				if (pending_calls.empty()) {
+					state = STATE_READY;
+					break;
+				}
+				calls.swap(pending_calls);
+			}
+			for (const std::function<void()> &call : calls) {
+				call();
+			}
+		}
 	} else {
-		ERR_PRINT("Sentry: Failed to initialize native SDK. Error code: " + itos(err));
+		ERR_PRINT("Sentry: Failed to initialize native SDK. Error code: " + itos(p_result));
+		{
+			std::lock_guard lock(pending_mutex);
+			pending_calls.clear();
+		}
+		if (p_async) {
+			// SentrySDK considered itself enabled while the native SDK was starting -- let it shut down.
+			SentrySDK::get_singleton()->close();
+		}
+		state = STATE_DISABLED;
+	}
+
+	replaying_pending_calls = false;
+	previous_session = sentry::native::journal::Recovered();
+
+	if (pending_dropped > 0) {
+		sentry::logging::print_warning(vformat("Dropped %d calls made while the SDK was starting (limit is %d)",
+				pending_dropped, MAX_PENDING_CALLS));
 	}
 }
 
 void NativeSDK::close() {
-	int err = sentry_close();
-	initialized = false;
+	// Replay calls queued while starting, so that they are not lost.
+	finish_init();
+
+	sentry::native::crash_context::stop_refreshing();
+
+	if (sentry::native::journal::is_open()) {
+		sentry::native::journal::close();
+		Ref<RuntimeConfig> runtime_config = SentrySDK::get_singleton()->get_runtime_config();
+		if (runtime_config.is_valid()) {
+			runtime_config->set_session_active(false);
+		}
+	}
+
+	int err = 0;
+	if (state.load() == STATE_READY) {
+		err = sentry_close();
+	}
+	state = STATE_DISABLED;
+	sentry::native::breadcrumbs::clear();
 
 	if (err != 0) {
 		ERR_PRINT("Sentry: Failed to close native SDK cleanly. Error code: " + itos(err));
@@ -447,7 +833,7 @@ void NativeSDK::close() {
 }
 
 bool NativeSDK::is_enabled() const {
-	return initialized;
+	return state.load(std::memory_order_relaxed) != STATE_DISABLED;
 }
 
 NativeSDK::NativeSDK() {
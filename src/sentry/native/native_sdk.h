@@ -2,20 +2,54 @@
 #define NATIVE_SDK_H
 
 #include "sentry/internal_sdk.h"
+#include "sentry/native/native_journal.h"
 
 #include <sentry.h>
+#include <atomic>
+#include <functional>
 #include <godot_cpp/classes/mutex.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace sentry::native {
 
 // Internal SDK utilizing sentry-native.
+//
+// With SentryOptions.async_init, sentry_init() runs on a background thread. Calls made while it
+// is starting are queued, and replayed in order on the main thread once it's done.
 class NativeSDK : public InternalSDK {
 private:
+	enum State : uint8_t {
+		STATE_DISABLED,
+		STATE_STARTING,
+		STATE_READY,
+	};
+
 	sentry_uuid_t last_uuid;
 	Ref<Mutex> last_uuid_mutex;
-	bool initialized = false;
+	std::atomic<State> state{ STATE_DISABLED };
+
+	std::thread init_thread;
+	std::atomic<int> init_result{ 0 };
+	uint64_t init_start_usec = 0;
+	sentry::native::journal::Recovered previous_session;
+
+	std::mutex pending_mutex;
+	std::vector<std::function<void()>> pending_calls;
+	int64_t pending_dropped = 0;
+
+	// True if a call should be queued instead, because the SDK is starting.
+	bool _is_starting() const;
+	// Queues the call, or drops it if the queue is full. Returns false if the SDK is no longer starting.
+	bool _defer(std::function<void()> &&p_call);
+
+	void _on_started(int p_result, bool p_async);
 
 public:
+	// NOTE: sentry-native can't mark byte attachments as view hierarchy, so it's delivered by file path.
+	virtual BitField<Capabilities> get_capabilities() const override { return SUPPORTS_ALL & ~SUPPORTS_EVENT_VIEW_HIERARCHY; }
+
 	virtual void set_context(const String &p_key, const Dictionary &p_value) override;
 	virtual void remove_context(const String &p_key) override;
 
@@ -40,10 +74,18 @@ public:
 
 	virtual void add_attachment(const Ref<SentryAttachment> &p_attachment) override;
 
+	virtual Ref<SentryTransaction> start_transaction(const String &p_name, const String &p_operation, int64_t p_start_timestamp_usec = 0) override;
+
+	virtual bool flush(int p_timeout_ms) override;
+
 	virtual void init(const PackedStringArray &p_global_attachments, const Callable &p_configuration_callback) override;
 	virtual void close() override;
 	virtual bool is_enabled() const override;
 
+	// Completes initialization started on a background thread: replays queued calls.
+	// Blocks until the background thread is done. Must be called on the main thread.
+	void finish_init();
+
 	NativeSDK();
 	virtual ~NativeSDK() override;
 };
@@ -0,0 +1,102 @@
+#include "native_transaction.h"
+
+#include "sentry/logging/print.h"
+#include "sentry/native/native_util.h"
+#include "sentry/script_profiler.h"
+
+#include <godot_cpp/classes/time.hpp>
+
+namespace sentry::native {
+
+// *** NativeSpan
+
+Ref<SentrySpan> NativeSpan::start_child(const String &p_operation, const String &p_description) {
+	sentry::script_profiler::sample_point();
+	ERR_FAIL_COND_V_MSG(finished, Ref<SentrySpan>(), "Sentry: Can't start child span - span is already finished.");
+	sentry_span_t *child = native_span
+			? sentry_span_start_child(native_span, p_operation.utf8(), p_description.utf8())
+			: nullptr;
+	return memnew(NativeSpan(child));
+}
+
+void NativeSpan::set_data(const String &p_key, const Variant &p_value) {
+	if (native_span && !finished) {
+		sentry_span_set_data(native_span, p_key.utf8(), variant_to_sentry_value(p_value));
+	}
+}
+
+void NativeSpan::finish() {
+	sentry::script_profiler::sample_point();
+	if (finished) {
+		return;
+	}
+	finished = true;
+	if (native_span) {
+		sentry_span_finish(native_span);
+		native_span = nullptr;
+	}
+}
+
+NativeSpan::NativeSpan(sentry_span_t *p_native_span) :
+		native_span(p_native_span) {
+}
+
+NativeSpan::~NativeSpan() {
+	if (native_span && !finished) {
+		// Native span must be finished to be released.
+		sentry::logging::print_debug("Span was not finished - marking it as cancelled");
+		sentry_span_set_status(native_span, SENTRY_SPAN_STATUS_CANCELLED);
+		sentry_span_finish(native_span);
+	}
+}
+
+// *** NativeTransaction
+
+Ref<SentrySpan> NativeTransaction::start_child(const String &p_operation, const String &p_description) {
+	sentry::script_profiler::sample_point();
+	ERR_FAIL_COND_V_MSG(finished, Ref<SentrySpan>(), "Sentry: Can't start child span - transaction is already finished.");
+	sentry_span_t *child = native_transaction
+			? sentry_transaction_start_child(native_transaction, p_operation.utf8(), p_description.utf8())
+			: nullptr;
+	return memnew(NativeSpan(child));
+}
+
+void NativeTransaction::set_data(const String &p_key, const Variant &p_value) {
+	if (native_transaction && !finished) {
+		sentry_transaction_set_data(native_transaction, p_key.utf8(), variant_to_sentry_value(p_value));
+	}
+}
+
+void NativeTransaction::finish() {
+	sentry::script_profiler::sample_point();
+	if (finished) {
+		return;
+	}
+	finished = true;
+	if (native_transaction) {
+		if (sentry::script_profiler::is_running()) {
+			Dictionary profile = sentry::script_profiler::make_profile(start_ticks_usec, Time::get_singleton()->get_ticks_usec());
+			if (!profile.is_empty()) {
+				sentry_transaction_set_data(native_transaction, "profile", variant_to_sentry_value(profile));
+			}
+		}
+		sentry_transaction_finish(native_transaction);
+		native_transaction = nullptr;
+	}
+}
+
+NativeTransaction::NativeTransaction(sentry_transaction_t *p_native_transaction, const String &p_name) :
+		native_transaction(p_native_transaction), name(p_name) {
+	start_ticks_usec = Time::get_singleton()->get_ticks_usec();
+}
+
+NativeTransaction::~NativeTransaction() {
+	if (native_transaction && !finished) {
+		// Native transaction must be finished to be released.
+		sentry::logging::print_debug("Transaction \"", name, "\" was not finished - marking it as cancelled");
+		sentry_transaction_set_status(native_transaction, SENTRY_SPAN_STATUS_CANCELLED);
+		sentry_transaction_finish(native_transaction);
+	}
+}
+
+} //namespace sentry::native
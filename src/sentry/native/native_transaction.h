@@ -0,0 +1,61 @@
+#pragma once
+
+#include "sentry/sentry_transaction.h"
+
+#include <sentry.h>
+
+namespace sentry::native {
+
+// Child span backed by sentry-native. Holds no native span if sentry-native discarded it
+// (e.g., the span limit was reached), in which case all operations do nothing.
+class NativeSpan : public SentrySpan {
+	GDCLASS(NativeSpan, SentrySpan);
+
+private:
+	sentry_span_t *native_span = nullptr;
+	bool finished = false;
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	virtual Ref<SentrySpan> start_child(const String &p_operation, const String &p_description = "") override;
+
+	virtual void set_data(const String &p_key, const Variant &p_value) override;
+
+	virtual void finish() override;
+	virtual bool is_finished() const override { return finished; }
+
+	NativeSpan() {}
+	NativeSpan(sentry_span_t *p_native_span);
+	virtual ~NativeSpan() override;
+};
+
+class NativeTransaction : public SentryTransaction {
+	GDCLASS(NativeTransaction, SentryTransaction);
+
+private:
+	sentry_transaction_t *native_transaction = nullptr;
+	String name;
+	uint64_t start_ticks_usec = 0;
+	bool finished = false;
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	virtual Ref<SentrySpan> start_child(const String &p_operation, const String &p_description = "") override;
+
+	virtual void set_data(const String &p_key, const Variant &p_value) override;
+
+	virtual void finish() override;
+	virtual bool is_finished() const override { return finished; }
+
+	virtual String get_name() const override { return name; }
+
+	NativeTransaction() {}
+	NativeTransaction(sentry_transaction_t *p_native_transaction, const String &p_name);
+	virtual ~NativeTransaction() override;
+};
+
+} //namespace sentry::native
@@ -0,0 +1,643 @@
+#include "native_transport.h"
+
+#include "sentry/logging/print.h"
+#include "sentry/telemetry.h"
+#include "sentry/util/envelope_uploader.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Config = sentry::native::transport::Config;
+using SentryOptions = sentry::SentryOptions;
+using EnvelopeUploader = sentry::util::EnvelopeUploader;
+
+// Envelopes uploaded over one connection before the worker checks the queue again.
+constexpr uint32_t BATCH_SIZE = 10;
+constexpr int64_t BACKOFF_INITIAL_MSEC = 1'000;
+constexpr int64_t BACKOFF_MAX_MSEC = 300'000;
+constexpr const char *ENVELOPE_EXTENSION = "envelope";
+
+int64_t _now_usec() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::system_clock::now().time_since_epoch())
+			.count();
+}
+
+// Spooled files are named "{spool time in usec}-{sequence}-{priority}.envelope", so that they sort in order.
+int64_t _get_spool_time_usec(const String &p_path) {
+	return p_path.get_file().get_slice("-", 0).to_int();
+}
+
+// *** Envelope inspection
+
+// Order in which envelopes are uploaded, and reverse order in which they are dropped or shed.
+enum Priority {
+	PRIORITY_CRASH,
+	PRIORITY_ERROR,
+	PRIORITY_FEEDBACK,
+	PRIORITY_LOG, // logs and transactions
+	PRIORITY_LOW, // sessions, client reports, and anything else
+	PRIORITY_MAX,
+};
+
+struct EnvelopeItem {
+	String type;
+	bool minidump = false;
+	size_t offset = 0; // of the item header
+	size_t size = 0; // of the item header, payload, and trailing newline
+};
+
+// Splits a serialized envelope into items. Returns false if the envelope is malformed.
+bool _parse_envelope(const char *p_data, size_t p_size, size_t &r_header_size, LocalVector<EnvelopeItem> &r_items) {
+	const char *end = p_data + p_size;
+	const char *header_end = (const char *)memchr(p_data, '\n', p_size);
+	if (!header_end) {
+		return false;
+	}
+	r_header_size = header_end + 1 - p_data;
+
+	const char *pos = header_end + 1;
+	while (pos < end) {
+		const char *item_header_end = (const char *)memchr(pos, '\n', end - pos);
+		if (!item_header_end) {
+			return false;
+		}
+		Variant parsed = JSON::parse_string(String::utf8(pos, item_header_end - pos));
+		if (parsed.get_type() != Variant::DICTIONARY) {
+			return false;
+		}
+		Dictionary item_header = parsed;
+
+		const char *payload = item_header_end + 1;
+		const char *payload_end;
+		if (item_header.has("length")) {
+			int64_t length = item_header["length"];
+			if (length < 0 || length > end - payload) {
+				return false;
+			}
+			payload_end = payload + length;
+		} else {
+			// Without length, payload ends at the next newline.
+			payload_end = (const char *)memchr(payload, '\n', end - payload);
+			payload_end = payload_end ? payload_end : end;
+		}
+		const char *item_end = (payload_end < end && *payload_end == '\n') ? payload_end + 1 : payload_end;
+
+		EnvelopeItem item;
+		item.type = item_header.get("type", "");
+		item.minidump = String(item_header.get("attachment_type", "")) == "event.minidump";
+		item.offset = pos - p_data;
+		item.size = item_end - pos;
+		r_items.push_back(item);
+		pos = item_end;
+	}
+	return true;
+}
+
+Priority _get_priority(const LocalVector<EnvelopeItem> &p_items, bool p_fatal) {
+	int priority = PRIORITY_LOW;
+	for (const EnvelopeItem &item : p_items) {
+		if (item.minidump || (item.type == "event" && p_fatal)) {
+			priority = MIN(priority, PRIORITY_CRASH);
+		} else if (item.type == "event") {
+			priority = MIN(priority, PRIORITY_ERROR);
+		} else if (item.type == "feedback" || item.type == "user_report") {
+			priority = MIN(priority, PRIORITY_FEEDBACK);
+		} else if (item.type == "log" || item.type == "transaction") {
+			priority = MIN(priority, PRIORITY_LOG);
+		}
+	}
+	return (Priority)priority;
+}
+
+// Returns the envelope without attachment items, and the number of attachments removed.
+PackedByteArray _strip_attachments(const char *p_data, size_t p_header_size, const LocalVector<EnvelopeItem> &p_items, int &r_removed) {
+	PackedByteArray stripped;
+	stripped.resize(p_header_size);
+	memcpy(stripped.ptrw(), p_data, p_header_size);
+	r_removed = 0;
+	for (const EnvelopeItem &item : p_items) {
+		if (item.type == "attachment" && !item.minidump) {
+			r_removed++;
+			continue;
+		}
+		int64_t offset = stripped.size();
+		stripped.resize(offset + item.size);
+		memcpy(stripped.ptrw() + offset, p_data + item.offset, item.size);
+	}
+	return stripped;
+}
+
+// *** Byte budget
+
+// Limits bytes spooled per session and per hour. Less important envelopes may only use a part of
+// the budget, so that the rest is kept for more important ones. Crashes are never shed.
+struct ByteBudget {
+	static constexpr double SHARE[PRIORITY_MAX] = { 1.0, 1.0, 0.9, 0.75, 0.5 };
+	static constexpr auto HOUR = std::chrono::hours{ 1 };
+
+	int64_t session_limit = 0; // unlimited if 0
+	int64_t hourly_limit = 0; // unlimited if 0
+	int64_t session_used = 0;
+	int64_t hour_used = 0;
+	Clock::time_point hour_start = Clock::now();
+
+	bool fits(int64_t p_size, Priority p_priority) {
+		if (p_priority == PRIORITY_CRASH) {
+			return true;
+		}
+		if (Clock::now() - hour_start >= HOUR) {
+			hour_start = Clock::now();
+			hour_used = 0;
+		}
+		return (session_limit == 0 || session_used + p_size <= session_limit * SHARE[p_priority]) &&
+				(hourly_limit == 0 || hour_used + p_size <= hourly_limit * SHARE[p_priority]);
+	}
+
+	void consume(int64_t p_size) {
+		session_used += p_size;
+		hour_used += p_size;
+	}
+};
+
+struct Spooled {
+	String path;
+	Priority priority = PRIORITY_LOW;
+};
+
+// Serialized envelope waiting to be written to disk. Data is allocated by sentry-native.
+struct Unwritten {
+	char *data = nullptr;
+	size_t size = 0;
+	bool fatal = false;
+	int64_t spool_usec = 0;
+};
+
+class SpoolingTransport {
+	Config config;
+	sentry::util::Endpoint endpoint;
+
+	std::mutex mutex;
+	std::condition_variable queue_cv;
+	std::condition_variable write_cv;
+	std::condition_variable idle_cv;
+	std::deque<Unwritten> unwritten; // handed over, but not yet spooled
+	uint32_t writing = 0;
+	std::deque<String> queues[PRIORITY_MAX]; // spooled files by priority, oldest first
+	uint32_t queued = 0;
+	uint32_t in_flight = 0;
+	ByteBudget budget;
+	uint64_t sequence = 0;
+	std::atomic<bool> stopping{ false };
+
+	// Backoff is shared by workers, as failures are usually caused by the network or the server.
+	Clock::time_point retry_after;
+	int64_t backoff_msec = 0;
+
+	std::thread writer;
+	std::vector<std::thread> workers;
+
+	_FORCE_INLINE_ bool _is_idle_locked() const {
+		return unwritten.empty() && writing == 0 && queued == 0 && in_flight == 0;
+	}
+	bool _wait_idle(std::unique_lock<std::mutex> &p_lock, uint64_t p_timeout_ms);
+
+	bool _enqueue_locked(const String &p_path, Priority p_priority);
+	void _write(const char *p_data, size_t p_size, bool p_fatal, int64_t p_spool_usec);
+	void _writer_loop();
+	void _remove_spooled(const String &p_path, bool p_sent);
+	String _compress(PackedByteArray &r_body) const;
+	uint32_t _upload_batch(EnvelopeUploader &p_uploader, const LocalVector<Spooled> &p_batch, int64_t &r_retry_after_msec);
+	void _worker_loop();
+
+public:
+	void spool(char *p_data, size_t p_size, bool p_fatal);
+	int startup(const sentry_options_t *p_options);
+	int flush(uint64_t p_timeout_ms);
+	int shutdown(uint64_t p_timeout_ms);
+
+	SpoolingTransport(const Config &p_config) :
+			config(p_config) {
+		budget.session_limit = p_config.session_budget_bytes;
+		budget.hourly_limit = p_config.hourly_budget_bytes;
+	}
+
+	~SpoolingTransport() {
+		for (const Unwritten &envelope : unwritten) {
+			sentry_free(envelope.data);
+		}
+	}
+};
+
+// *** SpoolingTransport
+
+// Returns false if the queue is full of more important envelopes, in which case the file is removed.
+bool SpoolingTransport::_enqueue_locked(const String &p_path, Priority p_priority) {
+	sentry::telemetry::add(sentry::telemetry::TRANSPORT_QUEUE_DEPTH);
+
+	if (queued >= (uint32_t)MAX(1, config.max_queued)) {
+		// Make room by dropping the oldest of the least important envelopes.
+		int lowest = PRIORITY_MAX - 1;
+		while (queues[lowest].empty()) {
+			lowest--;
+		}
+		if (lowest < p_priority) {
+			_remove_spooled(p_path, false);
+			sentry::logging::print_debug("Transport queue is full - dropped new envelope");
+			return false;
+		}
+		String oldest = queues[lowest].front();
+		queues[lowest].pop_front();
+		queued--;
+		_remove_spooled(oldest, false);
+		sentry::logging::print_debug("Transport queue is full - dropped oldest envelope");
+	}
+
+	queues[p_priority].push_back(p_path);
+	queued++;
+	return true;
+}
+
+void SpoolingTransport::_remove_spooled(const String &p_path, bool p_sent) {
+	DirAccess::remove_absolute(p_path);
+	sentry::telemetry::add(sentry::telemetry::TRANSPORT_QUEUE_DEPTH, -1);
+	if (p_sent) {
+		sentry::telemetry::add(sentry::telemetry::ENVELOPES_SENT);
+		sentry::telemetry::add(sentry::telemetry::TRANSPORT_QUEUE_WAIT_USEC, MAX(0, _now_usec() - _get_spool_time_usec(p_path)));
+	} else {
+		sentry::telemetry::add(sentry::telemetry::ENVELOPES_DROPPED_TRANSPORT);
+	}
+}
+
+// Takes ownership of the data. Envelopes are only queued here, as this runs on the thread that
+// captured the event; parsing and writing them to disk is left to the writer thread.
+void SpoolingTransport::spool(char *p_data, size_t p_size, bool p_fatal) {
+	{
+		std::lock_guard lock(mutex);
+		if (writer.joinable()) {
+			Unwritten envelope{ p_data, p_size, p_fatal, _now_usec() };
+			if (p_fatal) {
+				unwritten.push_front(envelope);
+			} else {
+				unwritten.push_back(envelope);
+			}
+			p_data = nullptr;
+		}
+	}
+	if (p_data) {
+		// Not started, or the DSN is invalid.
+		sentry_free(p_data);
+		sentry::telemetry::add(sentry::telemetry::ENVELOPES_DROPPED_TRANSPORT);
+		return;
+	}
+	write_cv.notify_one();
+}
+
+void SpoolingTransport::_write(const char *p_data, size_t p_size, bool p_fatal, int64_t p_spool_usec) {
+	size_t header_size = 0;
+	LocalVector<EnvelopeItem> items;
+	bool parsed = _parse_envelope(p_data, p_size, header_size, items);
+	Priority priority = parsed ? _get_priority(items, p_fatal) : (p_fatal ? PRIORITY_CRASH : PRIORITY_ERROR);
+
+	PackedByteArray bytes;
+	String path;
+	{
+		std::lock_guard lock(mutex);
+
+		if (!budget.fits(p_size, priority) && parsed) {
+			// Shed attachments first.
+			int removed = 0;
+			bytes = _strip_attachments(p_data, header_size, items, removed);
+			if (removed > 0) {
+				sentry::telemetry::add(sentry::telemetry::TRANSPORT_ATTACHMENTS_SHED, removed);
+				sentry::telemetry::add(sentry::telemetry::TRANSPORT_BYTES_SHED, p_size - bytes.size());
+				sentry::logging::print_debug("Transport byte budget exceeded - shed ", removed, " attachments");
+			}
+		}
+		int64_t size = bytes.is_empty() ? (int64_t)p_size : bytes.size();
+		if (!budget.fits(size, priority)) {
+			sentry::telemetry::add(sentry::telemetry::TRANSPORT_ENVELOPES_SHED);
+			sentry::telemetry::add(sentry::telemetry::TRANSPORT_BYTES_SHED, size);
+			sentry::logging::print_debug("Transport byte budget exceeded - shed envelope");
+			return;
+		}
+		budget.consume(size);
+
+		path = config.outbox_dir.path_join(vformat("%d-%d-%d.%s", p_spool_usec, sequence++, (int)priority, ENVELOPE_EXTENSION));
+	}
+
+	if (bytes.is_empty()) {
+		bytes.resize(p_size);
+		memcpy(bytes.ptrw(), p_data, p_size);
+	}
+
+	Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+	if (file.is_null()) {
+		sentry::logging::print_error("Failed to spool envelope: ", path);
+		sentry::telemetry::add(sentry::telemetry::ENVELOPES_DROPPED_TRANSPORT);
+		return;
+	}
+	file->store_buffer(bytes);
+	file->close();
+
+	{
+		std::lock_guard lock(mutex);
+		_enqueue_locked(path, priority);
+	}
+	queue_cv.notify_one();
+}
+
+// Writes envelopes to disk as they are handed over. When stopping, writes the rest before exiting,
+// so that they are picked up by the next session.
+void SpoolingTransport::_writer_loop() {
+	std::unique_lock lock(mutex);
+	while (true) {
+		if (unwritten.empty()) {
+			if (stopping) {
+				break;
+			}
+			write_cv.wait(lock);
+			continue;
+		}
+		Unwritten envelope = unwritten.front();
+		unwritten.pop_front();
+		writing++;
+
+		lock.unlock();
+		_write(envelope.data, envelope.size, envelope.fatal, envelope.spool_usec);
+		sentry_free(envelope.data);
+		lock.lock();
+
+		writing--;
+		idle_cv.notify_all();
+	}
+}
+
+// Compresses the body in place if it's large enough, and returns its content encoding (empty if not compressed).
+String SpoolingTransport::_compress(PackedByteArray &r_body) const {
+	if (config.compression == SentryOptions::COMPRESSION_NONE || r_body.size() < config.compression_threshold) {
+		return String();
+	}
+
+	// Compression level is taken from the engine's "compression/formats/*/compression_level" settings.
+	bool zstd = config.compression == SentryOptions::COMPRESSION_ZSTD;
+	PackedByteArray compressed = r_body.compress(zstd ? FileAccess::COMPRESSION_ZSTD : FileAccess::COMPRESSION_GZIP);
+	if (compressed.is_empty() || compressed.size() >= r_body.size()) {
+		return String();
+	}
+
+	sentry::telemetry::add(sentry::telemetry::TRANSPORT_BYTES_SAVED, r_body.size() - compressed.size());
+	r_body = compressed;
+	return zstd ? "zstd" : "gzip";
+}
+
+// Returns the number of envelopes that are done with; the rest should be retried.
+uint32_t SpoolingTransport::_upload_batch(EnvelopeUploader &p_uploader, const LocalVector<Spooled> &p_batch, int64_t &r_retry_after_msec) {
+	for (uint32_t i = 0; i < p_batch.size(); i++) {
+		if (stopping) {
+			return i;
+		}
+		const String &path = p_batch[i].path;
+		PackedByteArray body = FileAccess::get_file_as_bytes(path);
+		if (body.is_empty()) {
+			sentry::logging::print_error("Failed to read spooled envelope: ", path);
+			_remove_spooled(path, false);
+			continue;
+		}
+		String encoding = _compress(body);
+		EnvelopeUploader::Result result = p_uploader.upload(body, encoding, r_retry_after_msec);
+		if (result == EnvelopeUploader::UPLOAD_RETRY) {
+			return i;
+		}
+		_remove_spooled(path, result == EnvelopeUploader::UPLOAD_SENT);
+	}
+	return p_batch.size();
+}
+
+void SpoolingTransport::_worker_loop() {
+	EnvelopeUploader uploader(endpoint, &stopping);
+	std::unique_lock lock(mutex);
+	while (!stopping) {
+		if (queued == 0) {
+			queue_cv.wait(lock);
+			continue;
+		}
+		if (Clock::now() < retry_after) {
+			queue_cv.wait_until(lock, retry_after);
+			continue;
+		}
+
+		// Most important envelopes go first.
+		LocalVector<Spooled> batch;
+		for (int priority = 0; priority < PRIORITY_MAX && batch.size() < BATCH_SIZE; priority++) {
+			std::deque<String> &queue = queues[priority];
+			while (!queue.empty() && batch.size() < BATCH_SIZE) {
+				batch.push_back({ queue.front(), (Priority)priority });
+				queue.pop_front();
+			}
+		}
+		queued -= batch.size();
+		in_flight += batch.size();
+
+		lock.unlock();
+		int64_t server_retry_after_msec = 0;
+		uint32_t done = _upload_batch(uploader, batch, server_retry_after_msec);
+		lock.lock();
+
+		in_flight -= batch.size();
+		// Return what is left to the front of the queues, keeping the order.
+		for (int64_t i = (int64_t)batch.size() - 1; i >= (int64_t)done; i--) {
+			queues[batch[i].priority].push_front(batch[i].path);
+			queued++;
+		}
+
+		if (done < batch.size() && !stopping) {
+			backoff_msec = backoff_msec == 0 ? BACKOFF_INITIAL_MSEC : MIN(backoff_msec * 2, BACKOFF_MAX_MSEC);
+			int64_t delay_msec = MAX(backoff_msec, server_retry_after_msec);
+			retry_after = Clock::now() + std::chrono::milliseconds{ delay_msec };
+			sentry::telemetry::add(sentry::telemetry::TRANSPORT_RETRIES);
+			sentry::logging::print_debug("Transport backing off for ", delay_msec, " ms");
+		} else if (done == batch.size()) {
+			backoff_msec = 0;
+		}
+		idle_cv.notify_all();
+	}
+}
+
+int SpoolingTransport::startup(const sentry_options_t *p_options) {
+	const char *dsn = sentry_options_get_dsn(p_options);
+	endpoint = sentry::util::Endpoint::from_dsn(dsn ? String::utf8(dsn) : String());
+	if (!endpoint.valid) {
+		sentry::logging::print_warning("Spooling transport disabled - DSN is missing or invalid");
+		return 0;
+	}
+
+	DirAccess::make_dir_recursive_absolute(config.outbox_dir);
+
+	// Pick up envelopes left by the previous session.
+	PackedStringArray files = DirAccess::get_files_at(config.outbox_dir);
+	files.sort();
+	{
+		std::lock_guard lock(mutex);
+		for (const String &file : files) {
+			if (file.get_extension() == ENVELOPE_EXTENSION) {
+				int priority = CLAMP((int)file.get_basename().get_slice("-", 2).to_int(), 0, PRIORITY_MAX - 1);
+				_enqueue_locked(config.outbox_dir.path_join(file), (Priority)priority);
+			}
+		}
+		if (queued > 0) {
+			sentry::logging::print_debug("Transport resuming ", queued, " spooled envelopes");
+		}
+	}
+
+	stopping = false;
+	{
+		std::lock_guard lock(mutex);
+		writer = std::thread(&SpoolingTransport::_writer_loop, this);
+	}
+	for (int i = 0; i < MAX(1, config.workers); i++) {
+		workers.emplace_back(&SpoolingTransport::_worker_loop, this);
+	}
+	return 0;
+}
+
+// Returns true if everything handed over has been uploaded. Without workers, spooled envelopes
+// are never uploaded, so it only waits for them to be written.
+bool SpoolingTransport::_wait_idle(std::unique_lock<std::mutex> &p_lock, uint64_t p_timeout_ms) {
+	idle_cv.wait_for(p_lock, std::chrono::milliseconds{ p_timeout_ms }, [this] {
+		return _is_idle_locked() || (workers.empty() && unwritten.empty() && writing == 0);
+	});
+	return _is_idle_locked();
+}
+
+int SpoolingTransport::flush(uint64_t p_timeout_ms) {
+	std::unique_lock lock(mutex);
+	return _wait_idle(lock, p_timeout_ms) ? 0 : 1;
+}
+
+int SpoolingTransport::shutdown(uint64_t p_timeout_ms) {
+	bool drained;
+	{
+		std::unique_lock lock(mutex);
+		drained = _wait_idle(lock, p_timeout_ms);
+		stopping = true;
+	}
+	queue_cv.notify_all();
+	write_cv.notify_all();
+	for (std::thread &worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+	if (writer.joinable()) {
+		writer.join();
+	}
+
+	if (!drained) {
+		// Left on disk for the next session.
+		sentry::logging::print_debug("Transport shut down with envelopes still spooled");
+	}
+	return drained ? 0 : 1;
+}
+
+// *** Native callbacks
+
+void _send_envelope(sentry_envelope_t *p_envelope, void *p_state) {
+	sentry_value_t event = sentry_envelope_get_event(p_envelope);
+	bool fatal = !sentry_value_is_null(event) &&
+			strcmp(sentry_value_as_string(sentry_value_get_by_key(event, "level")), "fatal") == 0;
+
+	size_t size = 0;
+	char *data = sentry_envelope_serialize(p_envelope, &size);
+	sentry_envelope_free(p_envelope);
+	if (data) {
+		static_cast<SpoolingTransport *>(p_state)->spool(data, size, fatal);
+	}
+}
+
+int _startup(const sentry_options_t *p_options, void *p_state) {
+	return static_cast<SpoolingTransport *>(p_state)->startup(p_options);
+}
+
+int _flush(uint64_t p_timeout, void *p_state) {
+	return static_cast<SpoolingTransport *>(p_state)->flush(p_timeout);
+}
+
+int _shutdown(uint64_t p_timeout, void *p_state) {
+	return static_cast<SpoolingTransport *>(p_state)->shutdown(p_timeout);
+}
+
+void _free(void *p_state) {
+	delete static_cast<SpoolingTransport *>(p_state);
+}
+
+// *** Custom transport callbacks
+
+using CustomTransport = Ref<sentry::SentryTransport>;
+
+void _custom_send_envelope(sentry_envelope_t *p_envelope, void *p_state) {
+	size_t size = 0;
+	char *data = sentry_envelope_serialize(p_envelope, &size);
+	sentry_envelope_free(p_envelope);
+	if (data) {
+		PackedByteArray bytes;
+		bytes.resize(size);
+		memcpy(bytes.ptrw(), data, size);
+		sentry_free(data);
+		(*static_cast<CustomTransport *>(p_state))->send_envelope(bytes);
+	}
+}
+
+int _custom_startup(const sentry_options_t *p_options, void *p_state) {
+	return (*static_cast<CustomTransport *>(p_state))->startup() ? 0 : 1;
+}
+
+int _custom_flush(uint64_t p_timeout, void *p_state) {
+	return (*static_cast<CustomTransport *>(p_state))->flush((int)p_timeout) ? 0 : 1;
+}
+
+int _custom_shutdown(uint64_t p_timeout, void *p_state) {
+	return (*static_cast<CustomTransport *>(p_state))->shutdown((int)p_timeout) ? 0 : 1;
+}
+
+void _custom_free(void *p_state) {
+	delete static_cast<CustomTransport *>(p_state);
+}
+
+} // unnamed namespace
+
+namespace sentry::native::transport {
+
+sentry_transport_t *create(const Config &p_config) {
+	sentry_transport_t *transport = sentry_transport_new(_send_envelope);
+	sentry_transport_set_state(transport, new SpoolingTransport(p_config));
+	sentry_transport_set_free_func(transport, _free);
+	sentry_transport_set_startup_func(transport, _startup);
+	sentry_transport_set_flush_func(transport, _flush);
+	sentry_transport_set_shutdown_func(transport, _shutdown);
+	return transport;
+}
+
+sentry_transport_t *create_custom(const Ref<SentryTransport> &p_transport) {
+	sentry_transport_t *transport = sentry_transport_new(_custom_send_envelope);
+	sentry_transport_set_state(transport, new CustomTransport(p_transport));
+	sentry_transport_set_free_func(transport, _custom_free);
+	sentry_transport_set_startup_func(transport, _custom_startup);
+	sentry_transport_set_flush_func(transport, _custom_flush);
+	sentry_transport_set_shutdown_func(transport, _custom_shutdown);
+	return transport;
+}
+
+} //namespace sentry::native::transport
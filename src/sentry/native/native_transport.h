@@ -0,0 +1,43 @@
+#pragma once
+
+#include "sentry/sentry_options.h"
+
+#include <sentry.h>
+#include <godot_cpp/variant/string.hpp>
+
+using namespace godot;
+
+// Transport that spools envelopes to a bounded on-disk queue and uploads them in batches from
+// worker threads, backing off exponentially while ingestion is failing or rate-limiting
+// (see SentryOptions.transport_spooling).
+//
+// Envelopes are handed over to a writer thread, which writes them to disk, so that the capturing
+// thread doesn't wait for file I/O. Once written, they survive a crash or an unreachable server,
+// and are picked up again on the next start. Envelopes that are not yet written when shutting
+// down are written before the transport stops. When the queue is full,
+// the least important envelopes are dropped first: crashes are kept over errors, errors over
+// feedback, feedback over logs and transactions, and those over anything else. Uploads follow the
+// same order. With a byte budget, attachments are shed first when an envelope doesn't fit, and
+// less important envelopes are shed before the budget runs out. Compression is applied by the
+// workers, right before upload.
+namespace sentry::native::transport {
+
+struct Config {
+	String outbox_dir;
+	int max_queued = 100;
+	int workers = 1;
+	// Envelopes smaller than the threshold (in bytes) are sent uncompressed.
+	sentry::SentryOptions::EnvelopeCompression compression = sentry::SentryOptions::COMPRESSION_NONE;
+	int compression_threshold = 0;
+	// Bytes that may be spooled per session and per hour, unlimited if 0.
+	int64_t session_budget_bytes = 0;
+	int64_t hourly_budget_bytes = 0;
+};
+
+// Returns a transport to be passed to sentry_options_set_transport(), which takes ownership.
+sentry_transport_t *create(const Config &p_config);
+
+// Returns a transport that hands serialized envelopes to a SentryTransport (see SentryOptions.transport).
+sentry_transport_t *create_custom(const Ref<SentryTransport> &p_transport);
+
+} //namespace sentry::native::transport
@@ -0,0 +1,76 @@
+#include "options_snapshot.h"
+
+#include "sentry/sentry_options.h"
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace {
+
+using OptionsSnapshot = sentry::OptionsSnapshot;
+using Clock = std::chrono::steady_clock;
+
+const OptionsSnapshot default_snapshot;
+
+struct Replaced {
+	std::unique_ptr<const OptionsSnapshot> snapshot;
+	Clock::time_point replaced_at;
+};
+
+// Snapshots that were replaced, oldest first, kept while readers may still hold them.
+std::mutex publish_mutex;
+std::unique_ptr<const OptionsSnapshot> published;
+std::deque<Replaced> replaced;
+uint64_t last_version = 0;
+
+} // unnamed namespace
+
+namespace sentry::options_snapshot {
+
+std::atomic<const OptionsSnapshot *> current{ &default_snapshot };
+
+void publish(const SentryOptions *p_options) {
+	ERR_FAIL_NULL(p_options);
+
+	OptionsSnapshot *snapshot = new OptionsSnapshot;
+	snapshot->debug = p_options->is_debug_enabled();
+	snapshot->diagnostic_level = p_options->get_diagnostic_level();
+
+	snapshot->sample_rate = p_options->get_sample_rate();
+	snapshot->traces_sample_rate = p_options->get_traces_sample_rate();
+
+	snapshot->enable_logs = p_options->get_enable_logs();
+
+	snapshot->logger_include_source = p_options->is_logger_include_source_enabled();
+	snapshot->logger_include_variables = p_options->is_logger_include_variables_enabled();
+	snapshot->logger_messages_as_breadcrumbs = p_options->is_logger_messages_as_breadcrumbs_enabled();
+	snapshot->logger_event_mask = int(p_options->get_logger_event_mask());
+	snapshot->logger_breadcrumb_mask = int(p_options->get_logger_breadcrumb_mask());
+
+	Ref<SentryLoggerLimits> limits = p_options->get_logger_limits();
+	if (limits.is_valid()) {
+		snapshot->events_per_frame = limits->events_per_frame;
+		snapshot->repeated_error_window_ms = limits->repeated_error_window_ms;
+		snapshot->throttle_events = limits->throttle_events;
+		snapshot->throttle_window_ms = limits->throttle_window_ms;
+	}
+
+	std::lock_guard lock(publish_mutex);
+	snapshot->version = ++last_version;
+	current.store(snapshot, std::memory_order_release);
+
+	Clock::time_point now = Clock::now();
+	if (published) {
+		replaced.push_back({ std::move(published), now });
+	}
+	published.reset(snapshot);
+
+	while ((int)replaced.size() > RETAINED_SNAPSHOTS &&
+			now - replaced.front().replaced_at >= std::chrono::milliseconds{ GRACE_PERIOD_MSEC }) {
+		replaced.pop_front();
+	}
+}
+
+} //namespace sentry::options_snapshot
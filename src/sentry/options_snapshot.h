@@ -0,0 +1,66 @@
+#pragma once
+
+#include "sentry/godot_error_types.h"
+#include "sentry/level.h"
+
+#include <atomic>
+
+namespace sentry {
+
+class SentryOptions;
+
+// Immutable copy of the options read on hot paths: diagnostic printing, Godot logger integration and sampling.
+//
+// Compiled from SentryOptions and published through an atomic pointer, so reading it costs a single load,
+// with no refcounting involved. A snapshot is never modified once published -- changes at runtime (see
+// SentrySDK.update_limits()) publish a new one.
+//
+// Replaced snapshots are reclaimed after a grace period, as other threads may still be reading them:
+// the last few are kept regardless, and older ones once they have been replaced for longer than
+// GRACE_PERIOD_MSEC. Readers must therefore not hold on to a snapshot -- get() it, read what is needed,
+// and don't keep the pointer across calls that may block or run user code. To detect changes, compare
+// versions rather than pointers, as memory of a reclaimed snapshot may be reused by a newer one.
+struct OptionsSnapshot {
+	// Increases with each published snapshot; 0 for the defaults in effect before the first one.
+	uint64_t version = 0;
+
+	bool debug = false;
+	sentry::Level diagnostic_level = sentry::LEVEL_DEBUG;
+
+	double sample_rate = 1.0;
+	double traces_sample_rate = 0.0;
+
+	bool enable_logs = false;
+
+	bool logger_include_source = true;
+	bool logger_include_variables = false;
+	bool logger_messages_as_breadcrumbs = true;
+	int logger_event_mask = MASK_ALL_EXCEPT_WARNING;
+	int logger_breadcrumb_mask = MASK_ALL;
+
+	// See SentryLoggerLimits.
+	int events_per_frame = 5;
+	int repeated_error_window_ms = 1000;
+	int throttle_events = 20;
+	int throttle_window_ms = 10000;
+
+	_FORCE_INLINE_ bool should_capture_event(GodotErrorType p_error_type) const { return logger_event_mask & godot_error_type_as_mask(p_error_type); }
+	_FORCE_INLINE_ bool should_capture_breadcrumb(GodotErrorType p_error_type) const { return logger_breadcrumb_mask & godot_error_type_as_mask(p_error_type); }
+};
+
+namespace options_snapshot {
+
+constexpr int RETAINED_SNAPSHOTS = 4;
+constexpr int64_t GRACE_PERIOD_MSEC = 10'000;
+
+extern std::atomic<const OptionsSnapshot *> current;
+
+// Returns the current snapshot, never null. Thread-safe.
+_FORCE_INLINE_ const OptionsSnapshot *get() { return current.load(std::memory_order_acquire); }
+
+// Compiles options into a new snapshot and publishes it. Thread-safe.
+void publish(const SentryOptions *p_options);
+
+} //namespace options_snapshot
+
+} //namespace sentry
@@ -2,8 +2,12 @@
 
 #include "sentry/contexts.h"
 #include "sentry/logging/print.h"
+#include "sentry/metrics.h"
+#include "sentry/processing/processing_stats.h"
 #include "sentry/processing/sentry_event_processor.h"
+#include "sentry/script_profiler.h"
 #include "sentry/sentry_sdk.h"
+#include "sentry/telemetry.h"
 
 #include <godot_cpp/classes/dir_access.hpp>
 #include <godot_cpp/classes/display_server.hpp>
@@ -11,39 +15,54 @@
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/time.hpp>
+#include <optional>
 
 namespace sentry {
 
-Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) {
+Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event, AttachmentProduction p_attachments) {
 	if (p_event.is_null()) {
 		sentry::logging::print_error("Attempted to process a null event");
 		return nullptr;
 	}
 
 	sentry::logging::print_debug("Processing event ", p_event->get_id());
+	sentry::telemetry::ScopedTimer telemetry_timer{ sentry::telemetry::PROCESS_EVENT_USEC };
 
 	Ref<SentryEvent> event = p_event;
 
 	// Inject contexts.
-	// NOTE: On Cocoa/Android, crash reports are processed after app restart,
-	// so we skip enrichment to avoid attaching stale data from the current session.
-	// Native SDK processes crashes in the same session, so enrichment is safe.
-#if defined(SDK_COCOA) || defined(SDK_ANDROID)
-	constexpr bool enrich_crashes = false;
-#else
-	constexpr bool enrich_crashes = true;
-#endif
-	if (enrich_crashes || !p_event->is_crash()) {
+	// NOTE: Crash events are never enriched here. On Cocoa/Android, crash reports are processed
+	// after app restart, so this data would be stale. Native SDK attaches contexts prepared ahead
+	// of time in the crash handler, as querying the engine in a crashed process isn't safe.
+	if (!p_event->is_crash()) {
 		HashMap<String, Dictionary> contexts = sentry::contexts::make_event_contexts();
 		for (const auto &kv : contexts) {
 			event->merge_context(kv.key, kv.value);
 		}
+
+		if (sentry::script_profiler::is_running()) {
+			Dictionary profile = sentry::script_profiler::make_recent_profile();
+			if (!profile.is_empty()) {
+				event->merge_context("script_profile", profile);
+			}
+		}
 	}
 
 	// Event processors
 	for (const Ref<SentryEventProcessor> &processor : SENTRY_OPTIONS()->get_event_processors()) {
-		event = processor->process_event(event);
+		if (processor->produces_attachments()) {
+			continue;
+		}
+		const StringName &name = processor->get_stats_name();
+		if (sentry::processing_stats::should_skip(name)) {
+			continue;
+		}
+		{
+			sentry::processing_stats::ScopedTimer timer{ name };
+			event = processor->process_event(event);
+		}
 		if (event.is_null()) {
+			sentry::telemetry::add(sentry::telemetry::EVENTS_DROPPED_FILTERS);
 			return event;
 		} else if (event != p_event) {
 			sentry::logging::print_error("Event processor returned a different event object – discarding processor result");
@@ -53,7 +72,11 @@ Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) {
 
 	// Before send callback
 	if (const Callable &before_send = SENTRY_OPTIONS()->get_before_send(); before_send.is_valid()) {
-		event = before_send.call(event);
+		{
+			static const StringName callback_name = "before_send";
+			sentry::processing_stats::ScopedTimer timer{ callback_name, false };
+			event = before_send.call(event);
+		}
 
 		if (event.is_valid() && event != p_event) {
 			static bool first_print = true;
@@ -64,17 +87,75 @@ Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) {
 			} else {
 				sentry::logging::print_error("before_send callback must return the same event object or null.");
 			}
-			return p_event;
-		}
-
-		if (event.is_valid()) {
+			event = p_event;
+		} else if (event.is_valid()) {
 			sentry::logging::print_debug("before_send processed ", p_event->get_id());
 		} else {
 			sentry::logging::print_debug("before_send discarded ", p_event->get_id());
+			sentry::telemetry::add(sentry::telemetry::EVENTS_DROPPED_BEFORE_SEND);
+			return event;
+		}
+	}
+
+	// Metrics are taken only by events that are going to be sent, so that dropped events don't lose them.
+	if (!p_event->is_crash()) {
+		Dictionary metrics = sentry::metrics::take_batch();
+		if (!metrics.is_empty()) {
+			event->merge_context("metrics", metrics);
 		}
 	}
 
+	// Produce attachments -- only for events that are going to be sent.
+	if (p_attachments != PRODUCE_NO_ATTACHMENTS) {
+		std::optional<SentryEventProcessor::FileAttachmentsScope> file_attachments;
+		if (p_attachments == PRODUCE_FILE_ATTACHMENTS) {
+			file_attachments.emplace();
+		}
+		for (const Ref<SentryEventProcessor> &processor : SENTRY_OPTIONS()->get_event_processors()) {
+			if (!processor->produces_attachments()) {
+				continue;
+			}
+			if (p_attachments == PRODUCE_DEFERRED_ATTACHMENTS && processor->attaches_in_memory(event)) {
+				continue;
+			}
+			const StringName &name = processor->get_stats_name();
+			if (sentry::processing_stats::should_skip(name)) {
+				continue;
+			}
+			sentry::processing_stats::ScopedTimer timer{ name };
+			processor->produce_attachments(event);
+		}
+	}
+
+	sentry::telemetry::add(sentry::telemetry::EVENTS_CAPTURED);
 	return event;
 }
 
+bool has_event_filters() {
+	if (SENTRY_OPTIONS()->get_before_send().is_valid()) {
+		return true;
+	}
+	for (const Ref<SentryEventProcessor> &processor : SENTRY_OPTIONS()->get_event_processors()) {
+		if (!processor->produces_attachments()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void process_event_attachments(const Ref<SentryEvent> &p_event) {
+	ERR_FAIL_COND(p_event.is_null());
+
+	for (const Ref<SentryEventProcessor> &processor : SENTRY_OPTIONS()->get_event_processors()) {
+		if (processor->produces_attachments() && processor->attaches_in_memory(p_event)) {
+			const StringName &name = processor->get_stats_name();
+			if (sentry::processing_stats::should_skip(name)) {
+				continue;
+			}
+			sentry::processing_stats::ScopedTimer timer{ name };
+			processor->produce_attachments(p_event);
+		}
+	}
+}
+
 } // namespace sentry
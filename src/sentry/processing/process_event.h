@@ -5,9 +5,27 @@
 
 namespace sentry {
 
+// Selects attachment producers that run after the event is accepted.
+enum AttachmentProduction {
+	PRODUCE_ALL_ATTACHMENTS,
+	// In-memory attachments were already produced (see process_event_attachments()).
+	PRODUCE_DEFERRED_ATTACHMENTS,
+	// Backend already collected per-event attachments -- produce all of them as files.
+	PRODUCE_FILE_ATTACHMENTS,
+	PRODUCE_NO_ATTACHMENTS,
+};
+
 // Processes events by adding contexts, applying configured processors,
 // and running `before_send` callback before sending to Sentry.
-Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event);
+// Attachments are produced last, only if the event wasn't discarded.
+Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event, AttachmentProduction p_attachments = PRODUCE_ALL_ATTACHMENTS);
+
+// Returns true if event processors or `before_send` may discard events.
+bool has_event_filters();
+
+// Produces in-memory attachments, which are stored in the event (see SentryEvent::get_attachments()).
+// Used by backends that need per-event attachments before the event enters their pipeline.
+void process_event_attachments(const Ref<SentryEvent> &p_event);
 
 } //namespace sentry
 
@@ -1,5 +1,6 @@
 #include "process_log.h"
 
+#include "sentry/processing/processing_stats.h"
 #include "sentry/sentry_sdk.h"
 
 namespace sentry {
@@ -10,7 +11,12 @@ Ref<SentryLog> process_log(const Ref<SentryLog> &p_log) {
 		return p_log;
 	}
 
-	Ref<SentryLog> processed = before_send_log.call(p_log);
+	Ref<SentryLog> processed;
+	{
+		static const StringName callback_name = "before_send_log";
+		sentry::processing_stats::ScopedTimer timer{ callback_name, false };
+		processed = before_send_log.call(p_log);
+	}
 	if (processed.is_null()) {
 		return nullptr;
 	}
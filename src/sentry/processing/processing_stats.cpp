@@ -0,0 +1,116 @@
+#include "processing_stats.h"
+
+#include "sentry/logging/print.h"
+#include "sentry/sentry_sdk.h"
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <mutex>
+
+namespace {
+
+// Consecutive runs over budget before a processor is suspended.
+constexpr int OVER_BUDGET_STREAK = 5;
+
+// Number of events a suspended processor skips before it's tried again.
+constexpr int SUSPENDED_RUNS = 20;
+
+struct Stats {
+	int64_t calls = 0;
+	int64_t total_usec = 0;
+	int64_t max_usec = 0;
+	int64_t last_usec = 0;
+	int64_t skipped = 0;
+	int over_budget_streak = 0;
+	int suspended_runs = 0;
+};
+
+std::mutex mutex;
+HashMap<StringName, Stats> stats_by_name;
+
+// Total time spent in user callbacks on this thread, excluded from enclosing processor timings.
+thread_local int64_t callbacks_usec = 0;
+
+} // unnamed namespace
+
+namespace sentry::processing_stats {
+
+void record(const StringName &p_name, int64_t p_usec, bool p_apply_budget) {
+	int64_t budget_usec = p_apply_budget ? (int64_t)SENTRY_OPTIONS()->get_processor_time_budget_ms() * 1000 : 0;
+	bool suspended = false;
+
+	{
+		std::lock_guard lock(mutex);
+		Stats &stats = stats_by_name[p_name];
+		stats.calls++;
+		stats.total_usec += p_usec;
+		stats.max_usec = MAX(stats.max_usec, p_usec);
+		stats.last_usec = p_usec;
+
+		if (budget_usec > 0 && p_usec > budget_usec) {
+			stats.over_budget_streak++;
+			if (stats.over_budget_streak >= OVER_BUDGET_STREAK) {
+				stats.over_budget_streak = 0;
+				stats.suspended_runs = SUSPENDED_RUNS;
+				suspended = true;
+			}
+		} else {
+			stats.over_budget_streak = 0;
+		}
+	}
+
+	// Only logged when the budget trips -- this runs for every event and log.
+	if (suspended) {
+		sentry::logging::print_warning(p_name, " is over the time budget (last run took ", p_usec, " usec) - skipping it for the next ", SUSPENDED_RUNS, " events");
+	}
+}
+
+bool should_skip(const StringName &p_name) {
+	std::lock_guard lock(mutex);
+	Stats *stats = stats_by_name.getptr(p_name);
+	if (stats == nullptr || stats->suspended_runs == 0) {
+		return false;
+	}
+	stats->suspended_runs--;
+	stats->skipped++;
+	return true;
+}
+
+Dictionary get_stats() {
+	std::lock_guard lock(mutex);
+	Dictionary result;
+	for (const KeyValue<StringName, Stats> &kv : stats_by_name) {
+		const Stats &stats = kv.value;
+		Dictionary entry;
+		entry["calls"] = stats.calls;
+		entry["total_usec"] = stats.total_usec;
+		entry["average_usec"] = stats.calls > 0 ? stats.total_usec / stats.calls : 0;
+		entry["max_usec"] = stats.max_usec;
+		entry["last_usec"] = stats.last_usec;
+		entry["skipped"] = stats.skipped;
+		result[String(kv.key)] = entry;
+	}
+	return result;
+}
+
+void reset() {
+	std::lock_guard lock(mutex);
+	stats_by_name.clear();
+}
+
+ScopedTimer::ScopedTimer(const StringName &p_name, bool p_apply_budget) :
+		name(p_name), apply_budget(p_apply_budget), start(std::chrono::steady_clock::now()), callbacks_usec_at_start(callbacks_usec) {}
+
+ScopedTimer::~ScopedTimer() {
+	int64_t elapsed_usec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	// Callbacks measured within this scope.
+	int64_t nested_usec = callbacks_usec - callbacks_usec_at_start;
+	if (apply_budget) {
+		record(name, MAX(0, elapsed_usec - nested_usec), true);
+	} else {
+		// Nested callbacks are already part of this one.
+		callbacks_usec = callbacks_usec_at_start + elapsed_usec;
+		record(name, elapsed_usec, false);
+	}
+}
+
+} //namespace sentry::processing_stats
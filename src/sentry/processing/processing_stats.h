@@ -0,0 +1,39 @@
+#pragma once
+
+#include <chrono>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+// Running wall-time statistics for event processors and callbacks, and the optional
+// per-processor time budget (see SentryOptions.processor_time_budget_ms).
+namespace sentry::processing_stats {
+
+// Records a single run of the processor or callback. User callbacks are never skipped,
+// so the time budget is only applied to processors.
+void record(const godot::StringName &p_name, int64_t p_usec, bool p_apply_budget);
+
+// Returns true if the processor should be skipped for this event. Processors are suspended
+// for a number of events after running over budget several times in a row.
+bool should_skip(const godot::StringName &p_name);
+
+// Returns statistics as a dictionary keyed by processor or callback name.
+godot::Dictionary get_stats();
+
+void reset();
+
+// Measures the scope and records it on destruction.
+// Time spent in user callbacks measured within a processor's scope (such as `before_capture_screenshot`
+// called by the screenshot processor) is recorded for the callback only. This way, a slow callback
+// doesn't count against the processor's time budget.
+class ScopedTimer {
+	godot::StringName name;
+	bool apply_budget;
+	std::chrono::steady_clock::time_point start;
+	int64_t callbacks_usec_at_start;
+
+public:
+	ScopedTimer(const godot::StringName &p_name, bool p_apply_budget = true);
+	~ScopedTimer();
+};
+
+} //namespace sentry::processing_stats
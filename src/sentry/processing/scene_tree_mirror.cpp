@@ -0,0 +1,250 @@
+#include "scene_tree_mirror.h"
+
+#include <godot_cpp/classes/node.hpp>
+
+using namespace godot;
+
+namespace sentry {
+
+void SceneTreeMirror::_encode_fields(Entry &p_entry, Node *p_node) {
+	sentry::util::UTF8Buffer buffer{ 256 };
+	encoder.append_fields(buffer, p_node);
+
+	encoded_size -= p_entry.fields.size();
+	p_entry.fields.resize(buffer.get_size());
+	memcpy(p_entry.fields.ptr(), buffer.ptr(), buffer.get_size());
+	encoded_size += p_entry.fields.size();
+}
+
+int32_t SceneTreeMirror::_add_entry(Node *p_node, int32_t p_parent) {
+	int32_t index;
+	if (free_entries.size() > 0) {
+		index = free_entries[free_entries.size() - 1];
+		free_entries.resize(free_entries.size() - 1);
+	} else {
+		index = entries.size();
+		entries.push_back(Entry());
+	}
+
+	Entry &entry = entries[index];
+	entry.node_id = p_node->get_instance_id();
+	entry.parent = p_parent;
+	entry.first_child = NONE;
+	entry.last_child = NONE;
+	entry.prev_sibling = NONE;
+	entry.next_sibling = NONE;
+	_encode_fields(entry, p_node);
+
+	if (p_parent != NONE) {
+		Entry &parent = entries[p_parent];
+		if (parent.last_child != NONE) {
+			entries[parent.last_child].next_sibling = index;
+			entry.prev_sibling = parent.last_child;
+		} else {
+			parent.first_child = index;
+		}
+		parent.last_child = index;
+	}
+
+	entry_by_node[entry.node_id] = index;
+	return index;
+}
+
+void SceneTreeMirror::_remove_subtree(int32_t p_index) {
+	Entry &top = entries[p_index];
+
+	// Unlink from parent.
+	if (top.prev_sibling != NONE) {
+		entries[top.prev_sibling].next_sibling = top.next_sibling;
+	} else if (top.parent != NONE) {
+		entries[top.parent].first_child = top.next_sibling;
+	}
+	if (top.next_sibling != NONE) {
+		entries[top.next_sibling].prev_sibling = top.prev_sibling;
+	} else if (top.parent != NONE) {
+		entries[top.parent].last_child = top.prev_sibling;
+	}
+	if (root == p_index) {
+		root = NONE;
+	}
+
+	// Release the whole subtree. Removal signals that arrive later for descendants are ignored.
+	LocalVector<int32_t> pending;
+	pending.push_back(p_index);
+	while (pending.size() > 0) {
+		int32_t index = pending[pending.size() - 1];
+		pending.resize(pending.size() - 1);
+
+		Entry &entry = entries[index];
+		for (int32_t child = entry.first_child; child != NONE; child = entries[child].next_sibling) {
+			pending.push_back(child);
+		}
+
+		entry_by_node.erase(entry.node_id);
+		encoded_size -= entry.fields.size();
+		entry.fields.clear();
+		entry.node_id = 0;
+		entry.parent = NONE;
+		entry.first_child = NONE;
+		entry.last_child = NONE;
+		entry.prev_sibling = NONE;
+		entry.next_sibling = NONE;
+		free_entries.push_back(index);
+	}
+}
+
+void SceneTreeMirror::_clear() {
+	entries.clear();
+	free_entries.clear();
+	entry_by_node.clear();
+	root = NONE;
+	encoded_size = 0;
+}
+
+void SceneTreeMirror::rebuild(Node *p_root) {
+	std::lock_guard lock(mutex);
+
+	_clear();
+	if (p_root == nullptr) {
+		return;
+	}
+
+	root = _add_entry(p_root, NONE);
+
+	LocalVector<Node *> nodes;
+	LocalVector<int32_t> parents;
+	for (int i = p_root->get_child_count() - 1; i >= 0; i--) {
+		nodes.push_back(p_root->get_child(i));
+		parents.push_back(root);
+	}
+
+	while (nodes.size() > 0) {
+		Node *node = nodes[nodes.size() - 1];
+		int32_t parent = parents[parents.size() - 1];
+		nodes.resize(nodes.size() - 1);
+		parents.resize(parents.size() - 1);
+
+		int32_t index = _add_entry(node, parent);
+		for (int i = node->get_child_count() - 1; i >= 0; i--) {
+			nodes.push_back(node->get_child(i));
+			parents.push_back(index);
+		}
+	}
+}
+
+void SceneTreeMirror::clear() {
+	std::lock_guard lock(mutex);
+	_clear();
+}
+
+void SceneTreeMirror::node_added(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	std::lock_guard lock(mutex);
+
+	if (entry_by_node.has(p_node->get_instance_id())) {
+		return;
+	}
+
+	Node *parent_node = p_node->get_parent();
+	if (parent_node == nullptr) {
+		if (root == NONE) {
+			root = _add_entry(p_node, NONE);
+		}
+		return;
+	}
+
+	// Parents enter the tree before their children, so the parent should already be mirrored.
+	const int32_t *parent = entry_by_node.getptr(parent_node->get_instance_id());
+	if (parent) {
+		_add_entry(p_node, *parent);
+	}
+}
+
+void SceneTreeMirror::node_removed(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	std::lock_guard lock(mutex);
+
+	const int32_t *index = entry_by_node.getptr(p_node->get_instance_id());
+	if (index) {
+		_remove_subtree(*index);
+	}
+}
+
+void SceneTreeMirror::node_renamed(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	std::lock_guard lock(mutex);
+
+	const int32_t *index = entry_by_node.getptr(p_node->get_instance_id());
+	if (index) {
+		_encode_fields(entries[*index], p_node);
+	}
+}
+
+size_t SceneTreeMirror::get_node_count() const {
+	std::lock_guard lock(mutex);
+	return entry_by_node.size();
+}
+
+size_t SceneTreeMirror::estimate_json_size() const {
+	std::lock_guard lock(mutex);
+	// Fields plus braces, commas and "children" keys.
+	return encoded_size + entry_by_node.size() * 24 + 64;
+}
+
+bool SceneTreeMirror::write_json(sentry::util::UTF8Buffer &p_buffer, const ViewHierarchyBudget &p_budget) const {
+	std::lock_guard lock(mutex);
+
+	// Depth-first walk over sibling links -- no auxiliary stack needed.
+	int32_t current = root;
+	int depth = 0;
+	int nodes_written = 0;
+	bool needs_comma = false;
+	bool truncated = false;
+
+	while (current != NONE) {
+		if (p_budget.is_exhausted(nodes_written)) {
+			truncated = true;
+			break;
+		}
+
+		const Entry &entry = entries[current];
+		p_buffer.append(needs_comma ? ",{" : "{");
+		p_buffer.append(entry.fields.ptr(), entry.fields.size());
+		nodes_written++;
+
+		if (entry.first_child != NONE && p_budget.allows_children(depth)) {
+			p_buffer.append(",\"children\":[");
+			current = entry.first_child;
+			depth++;
+			needs_comma = false;
+			continue;
+		}
+
+		truncated = truncated || entry.first_child != NONE;
+		p_buffer.append("}");
+		needs_comma = true;
+
+		// Move to the next sibling, closing finished parents along the way.
+		while (current != NONE) {
+			const Entry &done = entries[current];
+			if (done.next_sibling != NONE) {
+				current = done.next_sibling;
+				break;
+			}
+			current = done.parent;
+			if (current != NONE) {
+				p_buffer.append("]}");
+				depth--;
+			}
+		}
+	}
+
+	// Close levels left open by an early stop.
+	for (int i = 0; i < depth; i++) {
+		p_buffer.append("]}");
+	}
+
+	return truncated;
+}
+
+} //namespace sentry
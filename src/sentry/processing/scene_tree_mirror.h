@@ -0,0 +1,65 @@
+#pragma once
+
+#include "sentry/processing/view_hierarchy_builder.h"
+#include "sentry/util/utf8_buffer.h"
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <mutex>
+
+namespace godot {
+class Node;
+}
+
+namespace sentry {
+
+// Compact copy of the scene tree structure, updated incrementally from SceneTree signals.
+// Node fields are encoded as JSON once, when a node enters the tree or gets renamed, so that
+// serializing the mirror doesn't touch scene objects and may happen off the main thread.
+// NOTE: Children are listed in the order they entered the tree. Reordering via move_child()
+//       and script changes on nodes that are already in the tree are not reflected.
+class SceneTreeMirror {
+private:
+	static constexpr int32_t NONE = -1;
+
+	struct Entry {
+		uint64_t node_id = 0;
+		int32_t parent = NONE;
+		int32_t first_child = NONE;
+		int32_t last_child = NONE;
+		int32_t prev_sibling = NONE;
+		int32_t next_sibling = NONE;
+		godot::LocalVector<char> fields; // pre-encoded JSON fields without enclosing braces
+	};
+
+	godot::LocalVector<Entry> entries;
+	godot::LocalVector<int32_t> free_entries;
+	godot::HashMap<uint64_t, int32_t> entry_by_node;
+	int32_t root = NONE;
+	size_t encoded_size = 0;
+	NodeFieldEncoder encoder;
+	mutable std::mutex mutex;
+
+	void _encode_fields(Entry &p_entry, godot::Node *p_node);
+	int32_t _add_entry(godot::Node *p_node, int32_t p_parent);
+	void _remove_subtree(int32_t p_index);
+	void _clear();
+
+public:
+	// Discards current state and mirrors the subtree starting at p_root. Main thread only.
+	void rebuild(godot::Node *p_root);
+	void clear();
+
+	void node_added(godot::Node *p_node);
+	void node_removed(godot::Node *p_node);
+	void node_renamed(godot::Node *p_node);
+
+	size_t get_node_count() const;
+	size_t estimate_json_size() const;
+
+	// Writes mirrored nodes as a comma-separated list of JSON objects with nested "children".
+	// Returns true if output was cut short by the budget.
+	bool write_json(sentry::util::UTF8Buffer &p_buffer, const ViewHierarchyBudget &p_budget) const;
+};
+
+} //namespace sentry
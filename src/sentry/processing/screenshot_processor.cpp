@@ -3,7 +3,9 @@
 #include "sentry/common_defs.h"
 #include "sentry/godot_singletons.h"
 #include "sentry/logging/print.h"
+#include "sentry/processing/processing_stats.h"
 #include "sentry/sentry_sdk.h"
+#include "sentry/telemetry.h"
 #include "sentry/util/screenshot.h" // TODO: incorporate
 
 #include <godot_cpp/classes/dir_access.hpp>
@@ -14,72 +16,122 @@
 
 namespace sentry {
 
-Ref<SentryEvent> ScreenshotProcessor::process_event(const Ref<SentryEvent> &p_event) {
-	if (p_event.is_null()) {
-		sentry::logging::print_error("internal error: can't process null event");
-		return nullptr;
-	}
-
-	int32_t current_frame = Engine::get_singleton()->get_frames_drawn();
-
-	{
-		std::lock_guard lock{ mutex };
-
-		if (current_frame == last_screenshot_frame) {
-			sentry::logging::print_debug("Skipping screenshot - already processed this frame");
-			return p_event;
-		}
-
-		// Remove the outdated screenshot.
-		DirAccess::remove_absolute(screenshot_path);
-	}
+void ScreenshotProcessor::_attach_screenshot(const Ref<SentryEvent> &p_event, const PackedByteArray &p_buffer) {
+	Ref<SentryAttachment> attachment = SentryAttachment::create_with_bytes(p_buffer, SENTRY_SCREENSHOT_FN);
+	attachment->set_content_type("image/jpeg");
+	p_event->add_attachment(attachment);
+}
 
+bool ScreenshotProcessor::_should_capture(const Ref<SentryEvent> &p_event) const {
 	if (OS::get_singleton()->get_thread_caller_id() != OS::get_singleton()->get_main_thread_id()) {
 		sentry::logging::print_debug("Skipping screenshot - can only be performed on the main thread");
-		return p_event;
+		return false;
 	}
 
 	if (!sentry::godot_singletons::are_ready()) {
 		sentry::logging::print_debug("Skipping screenshot - too early in the app lifecycle");
-		return p_event;
+		return false;
 	}
 
 #if defined(SDK_COCOA) || defined(SDK_ANDROID)
 	if (p_event->is_crash()) {
 		sentry::logging::print_debug("Skipping screenshot - crash from previous session");
-		return p_event;
+		return false;
 	}
 #endif
 
 	if (DisplayServer::get_singleton()->get_name() == "headless") {
 		sentry::logging::print_debug("Skipping screenshot - headless mode");
-		return p_event;
+		return false;
 	}
 
 	if (p_event->get_level() < SENTRY_OPTIONS()->get_screenshot_level()) {
 		sentry::logging::print_debug("Skipping screenshot - screenshot level not met");
-		return p_event;
+		return false;
 	}
 
 	if (SENTRY_OPTIONS()->get_before_capture_screenshot().is_valid()) {
-		Variant result = SENTRY_OPTIONS()->get_before_capture_screenshot().call(p_event);
+		Variant result;
+		{
+			static const StringName callback_name = "before_capture_screenshot";
+			sentry::processing_stats::ScopedTimer timer{ callback_name, false };
+			result = SENTRY_OPTIONS()->get_before_capture_screenshot().call(p_event);
+		}
 		if (result.get_type() != Variant::BOOL) {
 			// Note: Using PRINT_ONCE to avoid feedback loop in case of error event.
 			ERR_PRINT_ONCE("Sentry: before_capture_screenshot callback failed: expected a boolean return value");
-			return p_event;
+			return false;
 		}
 		if (result.operator bool() == false) {
 			sentry::logging::print_debug("Skipping screenshot - before_capture_screenshot returned false");
-			return p_event;
+			return false;
 		}
 	}
 
-	mutex.lock();
-	last_screenshot_frame = current_frame;
-	mutex.unlock();
+	return true;
+}
+
+void ScreenshotProcessor::produce_attachments(const Ref<SentryEvent> &p_event) {
+	if (p_event.is_null()) {
+		sentry::logging::print_error("internal error: can't process null event");
+		return;
+	}
+
+	int32_t current_frame = Engine::get_singleton()->get_frames_drawn();
+	bool in_memory = can_attach_in_memory(p_event);
+
+	// Checked for every event, including those reusing a screenshot taken this frame,
+	// so that screenshot_level and before_capture_screenshot apply to each of them.
+	if (!_should_capture(p_event)) {
+		if (!in_memory) {
+			// Don't leave a screenshot on disk for the backend to pick up with this event.
+			auto lock = sentry::telemetry::lock_measured(mutex, sentry::telemetry::SCREENSHOT_MUTEX_WAIT_USEC);
+			DirAccess::remove_absolute(screenshot_path);
+			last_screenshot_frame = -1;
+		}
+		return;
+	}
+
+	{
+		auto lock = sentry::telemetry::lock_measured(mutex, sentry::telemetry::SCREENSHOT_MUTEX_WAIT_USEC);
+
+		if (current_frame == last_screenshot_frame) {
+			if (in_memory && !last_screenshot.is_empty()) {
+				sentry::logging::print_debug("Reusing screenshot taken this frame");
+				_attach_screenshot(p_event, last_screenshot);
+			} else {
+				sentry::logging::print_debug("Skipping screenshot - already processed this frame");
+			}
+			return;
+		}
+
+		if (!in_memory) {
+			// Remove the outdated screenshot.
+			DirAccess::remove_absolute(screenshot_path);
+		}
+		last_screenshot_frame = current_frame;
+	}
 
 	sentry::logging::print_debug("Taking screenshot");
-	PackedByteArray buffer = sentry::util::take_screenshot();
+	PackedByteArray buffer;
+	{
+		sentry::telemetry::ScopedTimer telemetry_timer{ sentry::telemetry::SCREENSHOT_CAPTURE_USEC };
+		buffer = sentry::util::take_screenshot();
+	}
+	sentry::telemetry::add(sentry::telemetry::BYTES_SERIALIZED, buffer.size());
+
+	if (in_memory) {
+		// Hand the buffer to the backend directly – no disk round-trip.
+		{
+			auto lock = sentry::telemetry::lock_measured(mutex, sentry::telemetry::SCREENSHOT_MUTEX_WAIT_USEC);
+			last_screenshot = buffer;
+		}
+
+		if (!buffer.is_empty()) {
+			_attach_screenshot(p_event, buffer);
+		}
+		return;
+	}
 
 	Ref<FileAccess> f = FileAccess::open(screenshot_path, FileAccess::WRITE);
 	if (f.is_valid()) {
@@ -89,8 +141,6 @@ Ref<SentryEvent> ScreenshotProcessor::process_event(const Ref<SentryEvent> &p_ev
 	} else {
 		sentry::logging::print_error("Failed to save ", screenshot_path);
 	}
-
-	return p_event;
 }
 
 ScreenshotProcessor::ScreenshotProcessor() {
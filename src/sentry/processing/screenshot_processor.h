@@ -14,13 +14,21 @@ class ScreenshotProcessor : public SentryEventProcessor {
 private:
 	String screenshot_path;
 	int32_t last_screenshot_frame = -1;
+	PackedByteArray last_screenshot;
 	std::mutex mutex;
 
+	void _attach_screenshot(const Ref<SentryEvent> &p_event, const PackedByteArray &p_buffer);
+
+	// Decides whether a new screenshot should be taken for the event.
+	bool _should_capture(const Ref<SentryEvent> &p_event) const;
+
 protected:
 	static void _bind_methods() {}
 
 public:
-	virtual Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) override;
+	virtual bool produces_attachments() const override { return true; }
+	virtual bool attaches_in_memory(const Ref<SentryEvent> &p_event) const override { return can_attach_in_memory(p_event); }
+	virtual void produce_attachments(const Ref<SentryEvent> &p_event) override;
 
 	ScreenshotProcessor();
 };
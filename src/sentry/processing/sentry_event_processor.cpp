@@ -1,7 +1,38 @@
 #include "sentry_event_processor.h"
 
+#include "sentry/sentry_sdk.h"
+
+namespace {
+
+thread_local int file_attachments_depth = 0;
+
+} // unnamed namespace
+
 namespace sentry {
 
+SentryEventProcessor::FileAttachmentsScope::FileAttachmentsScope() {
+	file_attachments_depth++;
+}
+
+SentryEventProcessor::FileAttachmentsScope::~FileAttachmentsScope() {
+	file_attachments_depth--;
+}
+
+bool SentryEventProcessor::can_attach_in_memory(const Ref<SentryEvent> &p_event, bool p_is_view_hierarchy) {
+	if (p_event.is_null() || p_event->is_crash()) {
+		// Crash handlers can't rely on event attachments, so files serve as fallback.
+		return false;
+	}
+	if (file_attachments_depth > 0) {
+		return false;
+	}
+	BitField<InternalSDK::Capabilities> caps = INTERNAL_SDK()->get_capabilities();
+	if (p_is_view_hierarchy && !caps.has_flag(InternalSDK::SUPPORTS_EVENT_VIEW_HIERARCHY)) {
+		return false;
+	}
+	return caps.has_flag(InternalSDK::SUPPORTS_EVENT_ATTACHMENTS);
+}
+
 void SentryEventProcessor::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("process_event"), &SentryEventProcessor::process_event);
 }
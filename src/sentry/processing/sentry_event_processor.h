@@ -4,23 +4,58 @@
 #include "sentry/sentry_event.h"
 
 #include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 
 using namespace godot;
 
 namespace sentry {
 
+class SentryOptions;
+
 // Base class for processing Sentry events before they are sent to the server.
 // Implementations can modify, or discard events by returning null.
 class SentryEventProcessor : public RefCounted {
 	GDCLASS(SentryEventProcessor, RefCounted);
 
+private:
+	friend class SentryOptions;
+
+	StringName stats_name;
+
 protected:
 	static void _bind_methods();
 
+	// Returns true if attachments for this event can be handed to the backend in memory.
+	// Otherwise, processors should fall back to files registered as global attachments.
+	static bool can_attach_in_memory(const Ref<SentryEvent> &p_event, bool p_is_view_hierarchy = false);
+
 public:
+	// While alive, can_attach_in_memory() returns false on the calling thread, so that attachments
+	// are produced as files. Used when the backend has already collected per-event attachments.
+	struct FileAttachmentsScope {
+		FileAttachmentsScope();
+		~FileAttachmentsScope();
+	};
+
+	// Name under which runs of this processor are timed (see processing_stats.h).
+	// Set once the processor is added to SentryOptions, so that it isn't looked up for each event.
+	_FORCE_INLINE_ const StringName &get_stats_name() const { return stats_name; }
+
 	// Returns the same event (potentially modified) or null to discard it.
 	virtual Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) { return p_event; }
 
+	// Returns true if this processor produces event attachments.
+	// Attachments are costly to produce, so it's done in a separate phase, only after the event
+	// was accepted by other processors and `before_send` (see produce_attachments()).
+	virtual bool produces_attachments() const { return false; }
+
+	// Returns true if attachments for this event are handed to the backend in memory.
+	// Some backends need those before the event enters the pipeline (see process_event_attachments()).
+	virtual bool attaches_in_memory(const Ref<SentryEvent> &p_event) const { return false; }
+
+	// Produces attachments for an accepted event.
+	virtual void produce_attachments(const Ref<SentryEvent> &p_event) {}
+
 	virtual ~SentryEventProcessor() = default;
 };
 
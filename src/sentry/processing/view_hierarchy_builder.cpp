@@ -1,7 +1,8 @@
 #include "view_hierarchy_builder.h"
 
+#include "sentry/processing/scene_tree_mirror.h"
+
 #include <godot_cpp/classes/engine.hpp>
-#include <godot_cpp/classes/json.hpp>
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/classes/script.hpp>
@@ -12,83 +13,151 @@ using namespace godot;
 
 namespace {
 
-inline void _start_name_value_pair_new(sentry::util::UTF8Buffer &p_builder, const char *p_name, const String &p_value) {
-	p_builder.append("\"");
-	p_builder.append(p_name);
-	p_builder.append("\":\"");
-	p_builder.append(p_value);
-	p_builder.append("\"");
-}
-
-inline void _next_name_value_pair_new(sentry::util::UTF8Buffer &p_builder, const char *p_name, const String &p_value) {
-	p_builder.append(",\"");
-	p_builder.append(p_name);
-	p_builder.append("\":\"");
-	p_builder.append(p_value);
-	p_builder.append("\"");
+inline void _next_name_value_pair(sentry::util::UTF8Buffer &p_buffer, const char *p_name, const String &p_value) {
+	p_buffer.append(",\"");
+	p_buffer.append(p_name);
+	p_buffer.append("\":\"");
+	p_buffer.append_json_escaped(p_value);
+	p_buffer.append("\"");
 }
 
 } // unnamed namespace
 
 namespace sentry {
 
-sentry::util::UTF8Buffer ViewHierarchyBuilder::build_json() {
+void NodeFieldEncoder::_append_class(sentry::util::UTF8Buffer &p_buffer, const String &p_class) {
+	LocalVector<char> *encoded = class_encodings.getptr(p_class);
+	if (!encoded) {
+		// Only a handful of classes appear in a typical tree, so encode each one once.
+		sentry::util::UTF8Buffer tmp{ 64 };
+		tmp.append(",\"class\":\"");
+		tmp.append_json_escaped(p_class);
+		tmp.append("\"");
+
+		encoded = &class_encodings.insert(p_class, LocalVector<char>())->value;
+		encoded->resize(tmp.get_size());
+		memcpy(encoded->ptr(), tmp.ptr(), tmp.get_size());
+	}
+	p_buffer.append(encoded->ptr(), encoded->size());
+}
+
+void NodeFieldEncoder::append_fields(sentry::util::UTF8Buffer &p_buffer, Node *p_node) {
+	p_buffer.append("\"name\":\"");
+	p_buffer.append_json_escaped(p_node->get_name());
+	p_buffer.append("\"");
+
+	_append_class(p_buffer, p_node->get_class());
+
+	String scene_path = p_node->get_scene_file_path();
+	if (!scene_path.is_empty()) {
+		_next_name_value_pair(p_buffer, "scene", scene_path);
+	}
+
+	const Ref<Script> &scr = p_node->get_script();
+	if (scr.is_valid()) {
+		_next_name_value_pair(p_buffer, "script", scr->get_path());
+	}
+}
+
+ViewHierarchyBudget ViewHierarchyBudget::make(int p_max_nodes, int p_max_depth, int p_time_budget_ms) {
+	ViewHierarchyBudget budget;
+	budget.max_nodes = MAX(0, p_max_nodes);
+	budget.max_depth = MAX(0, p_max_depth);
+	if (p_time_budget_ms > 0) {
+		budget.has_deadline = true;
+		budget.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(p_time_budget_ms);
+	}
+	return budget;
+}
+
+void ViewHierarchyBuilder::_update_estimate(size_t p_size) {
+	size_t estimate = estimated_buffer_size.load(std::memory_order_relaxed);
+	while (p_size > estimate && !estimated_buffer_size.compare_exchange_weak(estimate, p_size, std::memory_order_relaxed)) {
+	}
+}
+
+void ViewHierarchyBuilder::_finish_json(sentry::util::UTF8Buffer &p_buffer, bool p_truncated) {
+	p_buffer.append("]");
+	if (p_truncated) {
+		p_buffer.append(",\"truncated\":true");
+	}
+	p_buffer.append("}");
+}
+
+sentry::util::UTF8Buffer ViewHierarchyBuilder::build_json(const ViewHierarchyBudget &p_budget) {
 	SceneTree *sml = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
 	ERR_FAIL_NULL_V(sml, ::sentry::util::UTF8Buffer(0));
 
-	sentry::util::UTF8Buffer buffer{ size_t(estimated_buffer_size) };
+	sentry::util::UTF8Buffer buffer{ estimated_buffer_size.load(std::memory_order_relaxed) };
 
 	buffer.append(R"({"rendering_system":"Godot","windows":[)");
 
-	List<Node *> stack;
-	List<int> hierarchy;
+	node_stack.clear();
+	remaining_children.clear();
 
 	if (sml->get_root()) {
-		stack.push_back(sml->get_root());
+		node_stack.push_back(sml->get_root());
 	}
 
-	while (!stack.is_empty()) {
-		if (buffer.ends_with("}")) {
+	int nodes_written = 0;
+	bool needs_comma = false;
+	bool truncated = false;
+
+	while (node_stack.size() > 0) {
+		if (p_budget.is_exhausted(nodes_written)) {
+			truncated = true;
+			break;
+		}
+
+		if (needs_comma) {
 			buffer.append(",{");
 		} else {
 			buffer.append("{");
 		}
 
-		Node *node = stack.back()->get();
-		stack.pop_back();
-
-		_start_name_value_pair_new(buffer, "name", node->get_name());
-		_next_name_value_pair_new(buffer, "class", node->get_class());
-
-		String scene_path = node->get_scene_file_path();
-		if (!scene_path.is_empty()) {
-			_next_name_value_pair_new(buffer, "scene", scene_path);
-		}
+		Node *node = node_stack[node_stack.size() - 1];
+		node_stack.resize(node_stack.size() - 1);
 
-		const Ref<Script> &scr = node->get_script();
-		if (scr.is_valid()) {
-			_next_name_value_pair_new(buffer, "script", scr.is_valid() ? scr->get_path() : String());
-		}
+		encoder.append_fields(buffer, node);
+		nodes_written++;
 
-		if (node->get_child_count()) {
+		int child_count = node->get_child_count();
+		if (child_count > 0 && p_budget.allows_children(remaining_children.size())) {
 			buffer.append(",\"children\":[");
-			for (int i = node->get_child_count() - 1; i >= 0; i--) {
-				stack.push_back(node->get_child(i));
+			for (int i = child_count - 1; i >= 0; i--) {
+				node_stack.push_back(node->get_child(i));
 			}
-			hierarchy.push_back(node->get_child_count());
+			remaining_children.push_back(child_count);
+			needs_comma = false;
 		} else {
+			truncated = truncated || child_count > 0;
 			buffer.append("}");
-			while (!hierarchy.is_empty() && (--hierarchy.back()->get()) == 0) {
+			needs_comma = true;
+			while (remaining_children.size() > 0 && (--remaining_children[remaining_children.size() - 1]) == 0) {
 				buffer.append("]}");
-				hierarchy.pop_back();
+				remaining_children.resize(remaining_children.size() - 1);
 			}
 		}
 	}
 
-	buffer.append("]}");
+	// Close levels left open by an early stop.
+	for (uint32_t i = 0; i < remaining_children.size(); i++) {
+		buffer.append("]}");
+	}
 
-	// Update estimate
-	estimated_buffer_size = MAX(estimated_buffer_size, buffer.get_capacity());
+	_finish_json(buffer, truncated);
+	_update_estimate(buffer.get_capacity());
+
+	return buffer;
+}
+
+sentry::util::UTF8Buffer ViewHierarchyBuilder::build_json(const SceneTreeMirror &p_mirror, const ViewHierarchyBudget &p_budget) {
+	sentry::util::UTF8Buffer buffer{ MAX(estimated_buffer_size.load(std::memory_order_relaxed), p_mirror.estimate_json_size()) };
+
+	buffer.append(R"({"rendering_system":"Godot","windows":[)");
+	bool truncated = p_mirror.write_json(buffer, p_budget);
+	_finish_json(buffer, truncated);
+	_update_estimate(buffer.get_capacity());
 
 	return buffer;
 }
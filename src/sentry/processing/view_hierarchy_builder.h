@@ -2,18 +2,80 @@
 
 #include "sentry/util/utf8_buffer.h"
 
+#include <atomic>
+#include <chrono>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/variant/string.hpp>
 
+namespace godot {
+class Node;
+}
+
 namespace sentry {
 
+class SceneTreeMirror;
+
+// Caps the cost of a single view hierarchy capture. Zero disables the corresponding limit.
+struct ViewHierarchyBudget {
+	int max_nodes = 0;
+	int max_depth = 0;
+	std::chrono::steady_clock::time_point deadline;
+	bool has_deadline = false;
+
+	// Checked before emitting each node. The clock is only consulted every 64 nodes.
+	_FORCE_INLINE_ bool is_exhausted(int p_nodes_written) const {
+		if (max_nodes > 0 && p_nodes_written >= max_nodes) {
+			return true;
+		}
+		return has_deadline && (p_nodes_written & 63) == 0 && std::chrono::steady_clock::now() >= deadline;
+	}
+
+	_FORCE_INLINE_ bool allows_children(int p_depth) const { return max_depth <= 0 || p_depth < max_depth; }
+
+	// Starts the time budget, if any, from now.
+	static ViewHierarchyBudget make(int p_max_nodes, int p_max_depth, int p_time_budget_ms);
+};
+
+// Encodes node fields as JSON, caching encodings of class names.
+// Not thread-safe: meant to be used on the main thread, next to scene objects.
+class NodeFieldEncoder {
+private:
+	godot::HashMap<godot::String, godot::LocalVector<char>> class_encodings;
+
+	void _append_class(sentry::util::UTF8Buffer &p_buffer, const godot::String &p_class);
+
+public:
+	// Appends JSON fields describing a single node (without enclosing braces).
+	void append_fields(sentry::util::UTF8Buffer &p_buffer, godot::Node *p_node);
+};
+
+// Limits are passed with each capture, and the buffer size estimate is atomic, so that mirror
+// captures may run on several threads at once.
 class ViewHierarchyBuilder {
 private:
 	// Initial estimated buffer size for JSON serialization (bytes).
 	// This value is adjusted based on past data to minimize reallocations.
-	size_t estimated_buffer_size = 262'144;
+	std::atomic<size_t> estimated_buffer_size{ 262'144 };
+
+	NodeFieldEncoder encoder;
+
+	// DFS stacks are kept between captures to avoid allocations.
+	godot::LocalVector<godot::Node *> node_stack;
+	godot::LocalVector<int> remaining_children;
+
+	void _update_estimate(size_t p_size);
+	static void _finish_json(sentry::util::UTF8Buffer &p_buffer, bool p_truncated);
 
 public:
-	sentry::util::UTF8Buffer build_json();
+	// When a limit of p_budget is hit, the output is closed cleanly and marked with "truncated":true
+	// at the top level.
+	//
+	// Walks the live scene tree. Must be called on the main thread.
+	sentry::util::UTF8Buffer build_json(const ViewHierarchyBudget &p_budget = ViewHierarchyBudget());
+
+	// Streams a previously synchronized mirror. Safe to call from any thread.
+	sentry::util::UTF8Buffer build_json(const SceneTreeMirror &p_mirror, const ViewHierarchyBudget &p_budget = ViewHierarchyBudget());
 };
 
 } //namespace sentry
@@ -2,53 +2,139 @@
 
 #include "sentry/common_defs.h"
 #include "sentry/logging/print.h"
+#include "sentry/sentry_sdk.h"
+#include "sentry/telemetry.h"
 
 #include <chrono>
 #include <cstdio>
+#include <cstring>
+#include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
 
 namespace sentry {
 
-Ref<SentryEvent> ViewHierarchyProcessor::process_event(const Ref<SentryEvent> &p_event) {
-#ifdef DEBUG_ENABLED
-	auto start = std::chrono::high_resolution_clock::now();
-#endif
+void ViewHierarchyProcessor::produce_attachments(const Ref<SentryEvent> &p_event) {
+	bool in_memory = can_attach_in_memory(p_event, true);
 
-	std::remove(json_file_path.ptr());
+	if (!in_memory) {
+		std::remove(json_file_path.ptr());
+	}
 
-	if (OS::get_singleton()->get_thread_caller_id() != OS::get_singleton()->get_main_thread_id()) {
+	// The mirror is self-contained, so it can be serialized on any thread.
+	bool use_mirror = mirror_active.load();
+
+	if (!use_mirror && OS::get_singleton()->get_thread_caller_id() != OS::get_singleton()->get_main_thread_id()) {
 		sentry::logging::print_debug("Skipping scene tree capture - can only be performed on the main thread");
-		return p_event;
+		return;
 	}
 
 #if defined(SDK_COCOA) || defined(SDK_ANDROID)
 	if (p_event->is_crash()) {
 		sentry::logging::print_debug("Skipping scene tree capture - crash from previous session");
-		return p_event;
+		return;
 	}
 #endif
 
-	sentry::util::UTF8Buffer json_buffer = view_hierarchy_builder.build_json();
+	sentry::util::UTF8Buffer json_buffer = [&]() {
+		sentry::telemetry::ScopedTimer telemetry_timer{ sentry::telemetry::VIEW_HIERARCHY_CAPTURE_USEC };
+		const ViewHierarchyBudget budget = ViewHierarchyBudget::make(
+				SENTRY_OPTIONS()->get_scene_tree_max_nodes(),
+				SENTRY_OPTIONS()->get_scene_tree_max_depth(),
+				SENTRY_OPTIONS()->get_scene_tree_time_budget_ms());
+		return use_mirror
+				? view_hierarchy_builder.build_json(mirror, budget)
+				: view_hierarchy_builder.build_json(budget);
+	}();
+	sentry::telemetry::add(sentry::telemetry::BYTES_SERIALIZED, json_buffer.get_size());
 
-	FILE *f = std::fopen(json_file_path.ptr(), "wb");
-	if (f) {
-		size_t written = std::fwrite(json_buffer.ptr(), 1, json_buffer.get_size(), f);
-		if (written != json_buffer.get_size()) {
-			sentry::logging::print_error(vformat("Failed to write scene tree data - only wrote %d bytes out of %d", (int64_t)written, (int64_t)json_buffer.get_size()));
-		}
-		std::fclose(f);
+	if (in_memory) {
+		// Hand the buffer to the backend directly – no disk round-trip.
+		PackedByteArray bytes;
+		bytes.resize(json_buffer.get_size());
+		memcpy(bytes.ptrw(), json_buffer.ptr(), json_buffer.get_size());
+
+		Ref<SentryAttachment> attachment = SentryAttachment::create_with_bytes(bytes, SENTRY_VIEW_HIERARCHY_FN);
+		attachment->set_content_type("application/json");
+		attachment->set_attachment_type("event.view_hierarchy");
+		p_event->add_attachment(attachment);
 	} else {
-		sentry::logging::print_error(vformat("Failed to write scene tree data - unable to open file for writing: %s", json_file_path.get_data()));
+		FILE *f = std::fopen(json_file_path.ptr(), "wb");
+		if (f) {
+			size_t written = std::fwrite(json_buffer.ptr(), 1, json_buffer.get_size(), f);
+			if (written != json_buffer.get_size()) {
+				sentry::logging::print_error(vformat("Failed to write scene tree data - only wrote %d bytes out of %d", (int64_t)written, (int64_t)json_buffer.get_size()));
+			}
+			std::fclose(f);
+		} else {
+			sentry::logging::print_error(vformat("Failed to write scene tree data - unable to open file for writing: %s", json_file_path.get_data()));
+		}
+	}
+}
+
+void ViewHierarchyProcessor::_start_mirror() {
+	if (mirror_active || !SENTRY_OPTIONS()->is_scene_tree_mirror_enabled()) {
+		return;
 	}
 
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to start scene tree mirror - expected SceneTree instance as main loop.");
+
+#ifdef DEBUG_ENABLED
+	auto start = std::chrono::high_resolution_clock::now();
+#endif
+
+	mirror.rebuild(scene_tree->get_root());
+	scene_tree->connect("node_added", callable_mp(this, &ViewHierarchyProcessor::_on_node_added));
+	scene_tree->connect("node_removed", callable_mp(this, &ViewHierarchyProcessor::_on_node_removed));
+	scene_tree->connect("node_renamed", callable_mp(this, &ViewHierarchyProcessor::_on_node_renamed));
+	mirror_active = true;
+
 #ifdef DEBUG_ENABLED
 	auto end = std::chrono::high_resolution_clock::now();
 	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-	sentry::logging::print_debug("Capturing scene tree data took ", (int64_t)duration.count(), " usec");
+	sentry::logging::print_debug("Started scene tree mirror with ", (int64_t)mirror.get_node_count(), " nodes in ", (int64_t)duration.count(), " usec");
 #endif
+}
+
+void ViewHierarchyProcessor::_stop_mirror() {
+	if (!mirror_active) {
+		return;
+	}
+	mirror_active = false;
+
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	if (scene_tree) {
+		Callable on_added = callable_mp(this, &ViewHierarchyProcessor::_on_node_added);
+		Callable on_removed = callable_mp(this, &ViewHierarchyProcessor::_on_node_removed);
+		Callable on_renamed = callable_mp(this, &ViewHierarchyProcessor::_on_node_renamed);
+		if (scene_tree->is_connected("node_added", on_added)) {
+			scene_tree->disconnect("node_added", on_added);
+		}
+		if (scene_tree->is_connected("node_removed", on_removed)) {
+			scene_tree->disconnect("node_removed", on_removed);
+		}
+		if (scene_tree->is_connected("node_renamed", on_renamed)) {
+			scene_tree->disconnect("node_renamed", on_renamed);
+		}
+	}
 
-	return p_event;
+	mirror.clear();
+}
+
+void ViewHierarchyProcessor::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_POSTINITIALIZE: {
+			// Deferred: SceneTree may not exist yet during early initialization, and the option
+			// may still be changed in the configuration callback.
+			callable_mp(this, &ViewHierarchyProcessor::_start_mirror).call_deferred();
+		} break;
+		case NOTIFICATION_PREDELETE: {
+			_stop_mirror();
+		} break;
+	}
 }
 
 ViewHierarchyProcessor::ViewHierarchyProcessor() {
@@ -1,9 +1,12 @@
 #ifndef VIEW_HIERARCHY_PROCESSOR_H
 #define VIEW_HIERARCHY_PROCESSOR_H
 
+#include "sentry/processing/scene_tree_mirror.h"
 #include "sentry/processing/sentry_event_processor.h"
 #include "sentry/processing/view_hierarchy_builder.h"
 
+#include <atomic>
+#include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/variant/char_string.hpp>
 
 namespace sentry {
@@ -16,11 +19,25 @@ private:
 	CharString json_file_path;
 	ViewHierarchyBuilder view_hierarchy_builder;
 
+	// Optional incremental copy of the scene tree (see SentryOptions.scene_tree_mirror).
+	SceneTreeMirror mirror;
+	std::atomic<bool> mirror_active{ false };
+
+	void _start_mirror();
+	void _stop_mirror();
+
+	void _on_node_added(Node *p_node) { mirror.node_added(p_node); }
+	void _on_node_removed(Node *p_node) { mirror.node_removed(p_node); }
+	void _on_node_renamed(Node *p_node) { mirror.node_renamed(p_node); }
+
 protected:
 	static void _bind_methods() {}
+	void _notification(int p_what);
 
 public:
-	virtual Ref<SentryEvent> process_event(const Ref<SentryEvent> &p_event) override;
+	virtual bool produces_attachments() const override { return true; }
+	virtual bool attaches_in_memory(const Ref<SentryEvent> &p_event) const override { return can_attach_in_memory(p_event, true); }
+	virtual void produce_attachments(const Ref<SentryEvent> &p_event) override;
 
 	ViewHierarchyProcessor();
 };
@@ -20,6 +20,12 @@ void RuntimeConfig::set_installation_id(const String &p_id) {
 	conf->save(conf_path);
 }
 
+void RuntimeConfig::set_session_active(bool p_active) {
+	session_active = p_active;
+	conf->set_value("main", "session_active", session_active);
+	conf->save(conf_path);
+}
+
 void RuntimeConfig::load_file(const String &p_conf_path) {
 	ERR_FAIL_COND(p_conf_path.is_empty());
 
@@ -27,6 +33,7 @@ void RuntimeConfig::load_file(const String &p_conf_path) {
 	conf->load(conf_path);
 
 	installation_id = _ensure_string(conf->get_value("main", "installation_id", ""), "");
+	session_active = conf->get_value("main", "session_active", false);
 	if (installation_id.is_empty()) {
 		set_installation_id(sentry::uuid::make_uuid());
 	}
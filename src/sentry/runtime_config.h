@@ -17,6 +17,7 @@ private:
 
 	// Cached values.
 	String installation_id;
+	bool session_active = false;
 
 protected:
 	static void _bind_methods() {}
@@ -25,6 +26,10 @@ public:
 	String get_installation_id() const { return installation_id; }
 	void set_installation_id(const String &p_id);
 
+	// Set while a session is running; remains set if the process didn't shut down cleanly.
+	bool is_session_active() const { return session_active; }
+	void set_session_active(bool p_active);
+
 	void load_file(const String &p_conf_path);
 
 	RuntimeConfig();
@@ -0,0 +1,50 @@
+#include "sampling.h"
+
+#include "sentry/options_snapshot.h"
+#include "sentry/telemetry.h"
+#include "sentry/uuid.h"
+
+namespace {
+
+thread_local int sampled_capture_depth = 0;
+
+} // unnamed namespace
+
+namespace sentry::sampling {
+
+double roll() {
+	// Top 53 bits as a double in [0, 1).
+	return double(sentry::uuid::random_u64() >> 11) * 0x1.0p-53;
+}
+
+bool sample(double p_rate) {
+	if (p_rate >= 1.0) {
+		return true;
+	}
+	if (p_rate <= 0.0) {
+		return false;
+	}
+	return roll() < p_rate;
+}
+
+bool sample_event() {
+	if (sample(sentry::options_snapshot::get()->sample_rate)) {
+		return true;
+	}
+	sentry::telemetry::add(sentry::telemetry::EVENTS_DROPPED_SAMPLING);
+	return false;
+}
+
+SampledCaptureScope::SampledCaptureScope() {
+	sampled_capture_depth++;
+}
+
+SampledCaptureScope::~SampledCaptureScope() {
+	sampled_capture_depth--;
+}
+
+bool is_capture_sampled() {
+	return sampled_capture_depth > 0;
+}
+
+} //namespace sentry::sampling
@@ -0,0 +1,27 @@
+#pragma once
+
+// Sampling decisions for error events are made by the SDK before an event is built, so that
+// sampled-out events cost close to nothing. Backends are configured with a sample rate of 1.0,
+// and events originating in a backend (such as crash reports) are sampled as they are processed.
+namespace sentry::sampling {
+
+// Returns a uniformly distributed random number in [0, 1). Thread-safe.
+double roll();
+
+// Returns true with the probability of p_rate (clamped to [0, 1]). Thread-safe.
+bool sample(double p_rate);
+
+// Decides whether an error event should be captured, according to SentryOptions.sample_rate.
+bool sample_event();
+
+// Marks events captured on the current thread within this scope as already sampled.
+class SampledCaptureScope {
+public:
+	SampledCaptureScope();
+	~SampledCaptureScope();
+};
+
+// Returns true if an event is being captured on the current thread after an early sampling decision.
+bool is_capture_sampled();
+
+} //namespace sentry::sampling
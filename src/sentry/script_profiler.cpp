@@ -0,0 +1,352 @@
+#include "script_profiler.h"
+
+#include "sentry/logging/print.h"
+#include "sentry/sentry_sdk.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+constexpr uint32_t MAX_SAMPLES = 4096;
+constexpr uint32_t MAX_FRAMES = 4096;
+constexpr uint32_t MAX_STACKS = 4096;
+constexpr int MAX_STACK_DEPTH = 64;
+constexpr int MAX_REPORTED_STACKS = 50;
+constexpr uint64_t RECENT_PROFILE_USEC = 30'000'000;
+
+using Clock = std::chrono::steady_clock;
+
+// *** Sampler thread
+
+std::thread sampler_thread;
+std::mutex sampler_mutex;
+std::condition_variable sampler_cv;
+bool sampler_stopping = false;
+
+std::chrono::milliseconds sample_interval{ 10 };
+double max_overhead = 0.01;
+
+std::atomic<bool> running{ false };
+std::atomic<int64_t> sampling_usec{ 0 };
+std::atomic<int64_t> throttled_count{ 0 };
+
+// When the pending sample was requested, in Clock microseconds.
+std::atomic<int64_t> requested_usec{ 0 };
+
+_FORCE_INLINE_ int64_t _clock_usec() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+}
+
+void _sampler_loop() {
+	Clock::time_point start = Clock::now();
+	std::unique_lock lock(sampler_mutex);
+	while (!sampler_cv.wait_for(lock, sample_interval, [] { return sampler_stopping; })) {
+		int64_t elapsed_usec = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+		if (sampling_usec.load(std::memory_order_relaxed) > elapsed_usec * max_overhead) {
+			// Over budget -- skip until the main thread has spent enough time outside of sampling.
+			throttled_count.fetch_add(1, std::memory_order_relaxed);
+			continue;
+		}
+		if (!sentry::script_profiler::sample_requested.load(std::memory_order_relaxed)) {
+			requested_usec.store(_clock_usec(), std::memory_order_relaxed);
+			sentry::script_profiler::sample_requested.store(true, std::memory_order_release);
+		}
+	}
+}
+
+// *** Sample storage
+
+struct Sample {
+	uint64_t ticks_usec = 0;
+	uint32_t stack = 0;
+	// Time between the sample being requested and taken at the next SDK call.
+	uint32_t delay_usec = 0;
+};
+
+std::mutex data_mutex;
+
+Sample samples[MAX_SAMPLES];
+uint32_t sample_head = 0;
+uint32_t sample_count = 0;
+
+// Frames are interned as "function (file:line)", and stacks as ";"-joined frame indices, root first.
+LocalVector<String> frames;
+HashMap<String, uint32_t> frame_ids;
+LocalVector<String> stacks;
+HashMap<String, uint32_t> stack_ids;
+
+void _clear_samples() {
+	std::lock_guard lock(data_mutex);
+	sample_head = 0;
+	sample_count = 0;
+	frames.clear();
+	frame_ids.clear();
+	stacks.clear();
+	stack_ids.clear();
+}
+
+// Returns false if the frame limit is reached.
+bool _intern_frame(const String &p_frame, uint32_t &r_id) {
+	if (const uint32_t *id = frame_ids.getptr(p_frame)) {
+		r_id = *id;
+		return true;
+	}
+	if (frames.size() >= MAX_FRAMES) {
+		return false;
+	}
+	r_id = frames.size();
+	frames.push_back(p_frame);
+	frame_ids[p_frame] = r_id;
+	return true;
+}
+
+// Returns false if the stack limit is reached.
+bool _intern_stack(const String &p_key, uint32_t &r_id) {
+	if (const uint32_t *id = stack_ids.getptr(p_key)) {
+		r_id = *id;
+		return true;
+	}
+	if (stacks.size() >= MAX_STACKS) {
+		return false;
+	}
+	r_id = stacks.size();
+	stacks.push_back(p_key);
+	stack_ids[p_key] = r_id;
+	return true;
+}
+
+// Rebuilds the intern tables from samples still in the ring, dropping frames and stacks that are no
+// longer referenced. Oldest samples are dropped until the tables are at most half full, so that
+// compaction doesn't repeat on every sample when the ring holds too many distinct stacks.
+void _compact_tables() {
+	while (true) {
+		LocalVector<String> old_frames = frames;
+		LocalVector<String> old_stacks = stacks;
+		frames.clear();
+		frame_ids.clear();
+		stacks.clear();
+		stack_ids.clear();
+
+		// Newest first, so that samples which don't fit are the oldest ones.
+		HashMap<uint32_t, uint32_t> remapped;
+		for (uint32_t i = 0; i < sample_count; i++) {
+			Sample &sample = samples[(sample_head + MAX_SAMPLES - 1 - i) % MAX_SAMPLES];
+			if (const uint32_t *id = remapped.getptr(sample.stack)) {
+				sample.stack = *id;
+				continue;
+			}
+			String key;
+			bool fits = true;
+			for (const String &old_id : old_stacks[sample.stack].split(";")) {
+				uint32_t frame_id;
+				if (!_intern_frame(old_frames[old_id.to_int()], frame_id)) {
+					fits = false;
+					break;
+				}
+				if (!key.is_empty()) {
+					key += ";";
+				}
+				key += itos(frame_id);
+			}
+			uint32_t stack_id;
+			if (!fits || !_intern_stack(key, stack_id)) {
+				sample_count = i;
+				break;
+			}
+			remapped.insert(sample.stack, stack_id);
+			sample.stack = stack_id;
+		}
+
+		if (sample_count == 0 || (frames.size() <= MAX_FRAMES / 2 && stacks.size() <= MAX_STACKS / 2)) {
+			return;
+		}
+		sample_count /= 2;
+	}
+}
+
+void _record_sample(const Ref<ScriptBacktrace> &p_backtrace, uint64_t p_ticks_usec, int64_t p_delay_usec) {
+	int depth = MIN(p_backtrace->get_frame_count(), MAX_STACK_DEPTH);
+
+	std::lock_guard lock(data_mutex);
+
+	if (unlikely(frames.size() + depth > MAX_FRAMES || stacks.size() >= MAX_STACKS)) {
+		_compact_tables();
+	}
+
+	String key;
+	// Frame 0 is the innermost one, so walk backwards to get root first.
+	for (int i = depth - 1; i >= 0; i--) {
+		String frame = vformat("%s (%s:%d)", p_backtrace->get_frame_function(i),
+				p_backtrace->get_frame_file(i), p_backtrace->get_frame_line(i));
+		uint32_t frame_id;
+		if (!_intern_frame(frame, frame_id)) {
+			return;
+		}
+		if (!key.is_empty()) {
+			key += ";";
+		}
+		key += itos(frame_id);
+	}
+
+	uint32_t stack_id;
+	if (!_intern_stack(key, stack_id)) {
+		return;
+	}
+
+	samples[sample_head] = { p_ticks_usec, stack_id, (uint32_t)CLAMP(p_delay_usec, (int64_t)0, (int64_t)UINT32_MAX) };
+	sample_head = (sample_head + 1) % MAX_SAMPLES;
+	sample_count = MIN(sample_count + 1, MAX_SAMPLES);
+}
+
+struct StackCount {
+	uint32_t stack = 0;
+	int64_t count = 0;
+};
+
+struct StackCountComparator {
+	_FORCE_INLINE_ bool operator()(const StackCount &p_a, const StackCount &p_b) const { return p_a.count > p_b.count; }
+};
+
+String _fold_stack(uint32_t p_stack) {
+	PackedStringArray names;
+	for (const String &id : stacks[p_stack].split(";")) {
+		names.push_back(frames[id.to_int()]);
+	}
+	return String(";").join(names);
+}
+
+} // unnamed namespace
+
+namespace sentry::script_profiler {
+
+std::atomic<bool> sample_requested{ false };
+
+void take_sample(const TypedArray<Ref<ScriptBacktrace>> *p_backtraces) {
+	if (OS::get_singleton()->get_thread_caller_id() != OS::get_singleton()->get_main_thread_id()) {
+		// Leave the request for the main thread.
+		return;
+	}
+	if (!sample_requested.exchange(false, std::memory_order_acquire)) {
+		return;
+	}
+
+	Clock::time_point start = Clock::now();
+	int64_t delay_usec = std::chrono::duration_cast<std::chrono::microseconds>(start.time_since_epoch()).count() -
+			requested_usec.load(std::memory_order_relaxed);
+
+	TypedArray<Ref<ScriptBacktrace>> backtraces = p_backtraces
+			? *p_backtraces
+			: Engine::get_singleton()->capture_script_backtraces(false);
+
+	uint64_t ticks_usec = Time::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < backtraces.size(); i++) {
+		Ref<ScriptBacktrace> backtrace = backtraces[i];
+		if (backtrace.is_valid() && !backtrace->is_empty()) {
+			_record_sample(backtrace, ticks_usec, delay_usec);
+			break;
+		}
+	}
+
+	sampling_usec.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count(),
+			std::memory_order_relaxed);
+}
+
+void start() {
+	if (running || !SENTRY_OPTIONS()->is_script_profiler_enabled()) {
+		return;
+	}
+
+	sample_interval = std::chrono::milliseconds{ MAX(1, SENTRY_OPTIONS()->get_script_profiler_interval_ms()) };
+	max_overhead = CLAMP(SENTRY_OPTIONS()->get_script_profiler_max_overhead(), 0.0, 100.0) / 100.0;
+
+	_clear_samples();
+	sampling_usec = 0;
+	throttled_count = 0;
+	sampler_stopping = false;
+	running = true;
+
+	sentry::logging::print_debug("Starting script profiler with interval of ", (int64_t)sample_interval.count(), " ms");
+	sampler_thread = std::thread(&_sampler_loop);
+}
+
+void stop() {
+	if (!running) {
+		return;
+	}
+
+	{
+		std::lock_guard lock(sampler_mutex);
+		sampler_stopping = true;
+	}
+	sampler_cv.notify_all();
+	sampler_thread.join();
+
+	running = false;
+	sample_requested = false;
+
+	if (throttled_count > 0) {
+		sentry::logging::print_debug("Script profiler skipped ", throttled_count.load(), " samples to stay within the overhead budget");
+	}
+}
+
+bool is_running() {
+	return running.load(std::memory_order_relaxed);
+}
+
+Dictionary make_profile(uint64_t p_from_usec, uint64_t p_to_usec) {
+	std::lock_guard lock(data_mutex);
+
+	HashMap<uint32_t, int64_t> counts;
+	int64_t total = 0;
+	int64_t total_delay_usec = 0;
+	for (uint32_t i = 0; i < sample_count; i++) {
+		const Sample &sample = samples[(sample_head + MAX_SAMPLES - 1 - i) % MAX_SAMPLES];
+		if (sample.ticks_usec < p_from_usec) {
+			break; // older samples are out of range as well
+		}
+		if (sample.ticks_usec > p_to_usec) {
+			continue;
+		}
+		counts[sample.stack] += 1;
+		total++;
+		total_delay_usec += sample.delay_usec;
+	}
+
+	if (total == 0) {
+		return Dictionary();
+	}
+
+	LocalVector<StackCount> sorted;
+	for (const KeyValue<uint32_t, int64_t> &kv : counts) {
+		sorted.push_back({ kv.key, kv.value });
+	}
+	sorted.sort_custom<StackCountComparator>();
+
+	// Folded stack format: "root;...;leaf count"
+	Array folded;
+	for (uint32_t i = 0; i < sorted.size() && i < MAX_REPORTED_STACKS; i++) {
+		folded.append(_fold_stack(sorted[i].stack) + " " + itos(sorted[i].count));
+	}
+
+	Dictionary profile;
+	profile["interval_ms"] = (int64_t)sample_interval.count();
+	profile["samples"] = total;
+	profile["mean_delay_ms"] = total_delay_usec / 1000.0 / total;
+	profile["stacks"] = folded;
+	return profile;
+}
+
+Dictionary make_recent_profile() {
+	uint64_t now = Time::get_singleton()->get_ticks_usec();
+	return make_profile(now > RECENT_PROFILE_USEC ? now - RECENT_PROFILE_USEC : 0, now);
+}
+
+} //namespace sentry::script_profiler
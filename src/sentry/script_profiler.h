@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <godot_cpp/classes/script_backtrace.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+using namespace godot;
+
+// Sampling profiler for scripts running on the main thread (see SentryOptions.script_profiler).
+//
+// Script call stacks are thread-local in Godot, so they can't be read from another thread.
+// Instead, a sampler thread requests a sample every interval, and the main thread takes it
+// at the next safe point -- a call into the SDK that is cheap to check (see sample_point()).
+// The sampler thread also keeps the time spent taking samples within the overhead budget.
+//
+// NOTE: This biases samples towards SDK call sites: a stack is recorded where the main thread
+// happens to call into the SDK after the request, not where it was when the request was made.
+// The mean delay between the two is reported with each profile.
+//
+// Samples are kept in a fixed-size ring, with frames and stacks interned, and aggregated
+// into folded stacks when attached to a transaction or an error event.
+namespace sentry::script_profiler {
+
+extern std::atomic<bool> sample_requested;
+
+void take_sample(const TypedArray<Ref<ScriptBacktrace>> *p_backtraces);
+
+// Takes a sample if one is due. Costs a single atomic load otherwise.
+_FORCE_INLINE_ void sample_point() {
+	if (unlikely(sample_requested.load(std::memory_order_relaxed))) {
+		take_sample(nullptr);
+	}
+}
+
+// Same as above, reusing backtraces that were already captured.
+_FORCE_INLINE_ void sample_point(const TypedArray<Ref<ScriptBacktrace>> &p_backtraces) {
+	if (unlikely(sample_requested.load(std::memory_order_relaxed))) {
+		take_sample(&p_backtraces);
+	}
+}
+
+void start();
+void stop();
+bool is_running();
+
+// Aggregates samples taken in the given range of Time.get_ticks_usec() into a profile.
+// Returns an empty dictionary if there are no samples in range.
+Dictionary make_profile(uint64_t p_from_usec, uint64_t p_to_usec);
+
+// Profile of the recent activity, attached to error events.
+Dictionary make_recent_profile();
+
+} //namespace sentry::script_profiler
@@ -2,6 +2,7 @@
 #define SENTRY_EVENT_H
 
 #include "sentry/level.h"
+#include "sentry/sentry_attachment.h"
 #include "sentry/sentry_timestamp.h"
 
 #include <godot_cpp/classes/ref_counted.hpp>
@@ -37,10 +38,18 @@ public:
 		Vector<StackFrame> frames;
 	};
 
+private:
+	// Attachments produced for this event only, such as screenshot or view hierarchy.
+	Vector<Ref<SentryAttachment>> attachments;
+
 protected:
 	static void _bind_methods();
 
 public:
+	// NOTE: Event attachments are not exposed in the public API.
+	_FORCE_INLINE_ void add_attachment(const Ref<SentryAttachment> &p_attachment) { attachments.push_back(p_attachment); }
+	_FORCE_INLINE_ const Vector<Ref<SentryAttachment>> &get_attachments() const { return attachments; }
+
 	virtual String get_id() const = 0;
 
 	virtual void set_message(const String &p_message) = 0;
@@ -0,0 +1,105 @@
+#include "sentry_file_transport.h"
+
+#include "sentry/logging/print.h"
+#include "sentry/util/envelope_uploader.h"
+#include "sentry/util/simple_bind.h"
+
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/marshalls.hpp>
+#include <godot_cpp/classes/time.hpp>
+
+namespace sentry {
+
+// Line format: {"timestamp": <unix time>, "envelope": "<base64>"}
+// Envelopes are base64-encoded, as attachments may contain newlines and binary data.
+
+void SentryFileTransport::send_envelope(const PackedByteArray &p_envelope) {
+	Dictionary line;
+	line["timestamp"] = Time::get_singleton()->get_unix_time_from_system();
+	line["envelope"] = Marshalls::get_singleton()->raw_to_base64(p_envelope);
+
+	std::lock_guard lock(file_mutex);
+	ERR_FAIL_COND_MSG(file.is_null(), "Sentry: File transport is not started.");
+	file->store_line(JSON::stringify(line));
+	// Flushed on every envelope, so that it survives a crash.
+	file->flush();
+}
+
+bool SentryFileTransport::startup() {
+	std::lock_guard lock(file_mutex);
+	DirAccess::make_dir_recursive_absolute(path.get_base_dir());
+	file = FileAccess::open(path, FileAccess::file_exists(path) ? FileAccess::READ_WRITE : FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(file.is_null(), false, "Sentry: Failed to open envelope file: " + path);
+	file->seek_end();
+	sentry::logging::print_debug("Writing envelopes to ", path);
+	return true;
+}
+
+bool SentryFileTransport::flush(int p_timeout_ms) {
+	std::lock_guard lock(file_mutex);
+	if (file.is_valid()) {
+		file->flush();
+	}
+	return true;
+}
+
+bool SentryFileTransport::shutdown(int p_timeout_ms) {
+	std::lock_guard lock(file_mutex);
+	if (file.is_valid()) {
+		file->close();
+		file.unref();
+	}
+	return true;
+}
+
+int SentryFileTransport::reupload(const String &p_path, const String &p_dsn) {
+	sentry::util::Endpoint endpoint = sentry::util::Endpoint::from_dsn(p_dsn);
+	ERR_FAIL_COND_V_MSG(!endpoint.valid, 0, "Sentry: Invalid DSN: " + p_dsn);
+
+	String content = FileAccess::get_file_as_string(p_path);
+	ERR_FAIL_COND_V_MSG(content.is_empty() && !FileAccess::file_exists(p_path), 0, "Sentry: Envelope file not found: " + p_path);
+
+	sentry::util::EnvelopeUploader uploader(endpoint);
+	PackedStringArray lines = content.split("\n", false);
+	PackedStringArray remaining;
+	int uploaded = 0;
+
+	for (int i = 0; i < lines.size(); i++) {
+		Variant parsed = JSON::parse_string(lines[i]);
+		if (parsed.get_type() != Variant::DICTIONARY) {
+			sentry::logging::print_warning("Skipping malformed line ", i + 1, " in ", p_path);
+			continue;
+		}
+		PackedByteArray envelope = Marshalls::get_singleton()->base64_to_raw(((Dictionary)parsed).get("envelope", ""));
+
+		int64_t retry_after_msec = 0;
+		sentry::util::EnvelopeUploader::Result result = uploader.upload(envelope, String(), retry_after_msec);
+		if (result == sentry::util::EnvelopeUploader::UPLOAD_RETRY) {
+			// Ingestion is unavailable or rate-limiting -- keep the rest for later.
+			sentry::logging::print_warning("Re-upload interrupted, ", lines.size() - i, " envelopes left in ", p_path);
+			remaining = lines.slice(i);
+			break;
+		}
+		if (result == sentry::util::EnvelopeUploader::UPLOAD_SENT) {
+			uploaded++;
+		}
+	}
+
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(file.is_null(), uploaded, "Sentry: Failed to rewrite envelope file: " + p_path);
+	for (const String &line : remaining) {
+		file->store_line(line);
+	}
+
+	sentry::logging::print_debug("Re-uploaded ", uploaded, " envelopes from ", p_path);
+	return uploaded;
+}
+
+void SentryFileTransport::_bind_methods() {
+	ClassDB::bind_static_method("SentryFileTransport", D_METHOD("reupload", "path", "dsn"), &SentryFileTransport::reupload);
+
+	BIND_PROPERTY(SentryFileTransport, PropertyInfo(Variant::STRING, "path"), set_path, get_path);
+}
+
+} // namespace sentry
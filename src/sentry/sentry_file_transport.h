@@ -0,0 +1,40 @@
+#pragma once
+
+#include "sentry/sentry_transport.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <mutex>
+
+using namespace godot;
+
+namespace sentry {
+
+// Appends envelopes to an NDJSON file, one per line, for setups without access to ingestion.
+// Envelopes can be uploaded later with reupload().
+class SentryFileTransport : public SentryTransport {
+	GDCLASS(SentryFileTransport, SentryTransport);
+
+private:
+	String path = "user://sentry/envelopes.ndjson";
+
+	std::mutex file_mutex;
+	Ref<FileAccess> file;
+
+protected:
+	static void _bind_methods();
+
+public:
+	String get_path() const { return path; }
+	void set_path(const String &p_path) { path = p_path; }
+
+	virtual void send_envelope(const PackedByteArray &p_envelope) override;
+	virtual bool startup() override;
+	virtual bool flush(int p_timeout_ms) override;
+	virtual bool shutdown(int p_timeout_ms) override;
+
+	// Uploads envelopes from an NDJSON file to ingestion at the given DSN, blocking until done.
+	// Envelopes that couldn't be uploaded are kept in the file. Returns the number of uploaded envelopes.
+	static int reupload(const String &p_path, const String &p_dsn);
+};
+
+} // namespace sentry
@@ -2,6 +2,7 @@
 
 #include "sentry/sentry_log.h" // Needed for VariantCaster<LogLevel>
 #include "sentry/sentry_sdk.h"
+#include "sentry/telemetry.h"
 
 namespace sentry {
 
@@ -18,6 +19,7 @@ void SentryLogger::log(LogLevel p_level, const String &p_body, const Array &p_pa
 		body = p_body % p_params;
 	}
 	INTERNAL_SDK()->log(p_level, body, attributes);
+	sentry::telemetry::add(sentry::telemetry::LOGS_ADDED);
 }
 
 void SentryLogger::trace(const String &p_body, const Array &p_params, const Dictionary &p_attributes) {
@@ -0,0 +1,46 @@
+#include "sentry_metrics.h"
+
+#include "sentry/metrics.h"
+
+namespace sentry {
+
+void SentryMetrics::increment(const StringName &p_name, double p_value, const Dictionary &p_tags) {
+	if (sentry::metrics::is_active()) {
+		sentry::metrics::record(sentry::metrics::COUNTER, p_name, p_value, p_tags);
+	}
+}
+
+void SentryMetrics::gauge(const StringName &p_name, double p_value, const Dictionary &p_tags) {
+	if (sentry::metrics::is_active()) {
+		sentry::metrics::record(sentry::metrics::GAUGE, p_name, p_value, p_tags);
+	}
+}
+
+void SentryMetrics::distribution(const StringName &p_name, double p_value, const Dictionary &p_tags) {
+	if (sentry::metrics::is_active()) {
+		sentry::metrics::record(sentry::metrics::DISTRIBUTION, p_name, p_value, p_tags);
+	}
+}
+
+void SentryMetrics::add_to_set(const StringName &p_name, const Variant &p_value, const Dictionary &p_tags) {
+	if (sentry::metrics::is_active()) {
+		// Only hashes are kept to count unique values.
+		sentry::metrics::record(sentry::metrics::SET, p_name, (double)p_value.hash(), p_tags);
+	}
+}
+
+Dictionary SentryMetrics::flush() {
+	return sentry::metrics::flush();
+}
+
+void SentryMetrics::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("increment", "name", "value", "tags"), &SentryMetrics::increment, DEFVAL(1.0), DEFVAL(Dictionary()));
+	ClassDB::bind_method(D_METHOD("gauge", "name", "value", "tags"), &SentryMetrics::gauge, DEFVAL(Dictionary()));
+	ClassDB::bind_method(D_METHOD("distribution", "name", "value", "tags"), &SentryMetrics::distribution, DEFVAL(Dictionary()));
+	ClassDB::bind_method(D_METHOD("add_to_set", "name", "value", "tags"), &SentryMetrics::add_to_set, DEFVAL(Dictionary()));
+	ClassDB::bind_method(D_METHOD("flush"), &SentryMetrics::flush);
+}
+
+SentryMetrics::SentryMetrics() {}
+
+} // namespace sentry
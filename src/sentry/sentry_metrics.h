@@ -0,0 +1,28 @@
+#pragma once
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+using namespace godot;
+
+namespace sentry {
+
+// Public interface for metrics aggregated in process (see sentry::metrics).
+class SentryMetrics : public Object {
+	GDCLASS(SentryMetrics, Object);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void increment(const StringName &p_name, double p_value = 1.0, const Dictionary &p_tags = Dictionary());
+	void gauge(const StringName &p_name, double p_value, const Dictionary &p_tags = Dictionary());
+	void distribution(const StringName &p_name, double p_value, const Dictionary &p_tags = Dictionary());
+	void add_to_set(const StringName &p_name, const Variant &p_value, const Dictionary &p_tags = Dictionary());
+
+	Dictionary flush();
+
+	SentryMetrics();
+};
+
+} // namespace sentry
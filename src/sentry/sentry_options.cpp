@@ -107,13 +107,36 @@ void SentryOptions::_define_project_settings(const Ref<SentryOptions> &p_options
 	_define_setting(PropertyInfo(Variant::INT, "sentry/options/debug_printing", PROPERTY_HINT_ENUM, "Off,On,Auto"), (int)SentryOptions::DEBUG_DEFAULT);
 	_define_setting(sentry::make_level_enum_property("sentry/options/diagnostic_level"), p_options->diagnostic_level);
 	_define_setting(PropertyInfo(Variant::FLOAT, "sentry/options/sample_rate", PROPERTY_HINT_RANGE, "0.0,1.0"), p_options->sample_rate, false);
+	_define_setting(PropertyInfo(Variant::FLOAT, "sentry/options/traces_sample_rate", PROPERTY_HINT_RANGE, "0.0,1.0"), p_options->traces_sample_rate, false);
+	_define_setting("sentry/options/trace_scene_changes", p_options->trace_scene_changes, false);
+	_define_setting("sentry/options/trace_threaded_loads", p_options->trace_threaded_loads, false);
 	_define_setting(PropertyInfo(Variant::INT, "sentry/options/max_breadcrumbs", PROPERTY_HINT_RANGE, "0, 500"), p_options->max_breadcrumbs, false);
 	_define_setting("sentry/options/send_default_pii", p_options->send_default_pii);
 
 	_define_setting("sentry/options/attach_log", p_options->attach_log, false);
 	_define_setting("sentry/options/attach_scene_tree", p_options->attach_scene_tree);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/scene_tree/max_nodes", PROPERTY_HINT_RANGE, "0,1000000,1,or_greater"), p_options->scene_tree_max_nodes, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/scene_tree/max_depth", PROPERTY_HINT_RANGE, "0,1000"), p_options->scene_tree_max_depth, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/scene_tree/time_budget_ms", PROPERTY_HINT_RANGE, "0,1000"), p_options->scene_tree_time_budget_ms, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/processor_time_budget_ms", PROPERTY_HINT_RANGE, "0,1000"), p_options->processor_time_budget_ms, false);
 
 	_define_setting("sentry/options/enable_logs", p_options->enable_logs, false);
+	_define_setting("sentry/options/enable_metrics", p_options->enable_metrics, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/metrics_flush_interval_sec", PROPERTY_HINT_RANGE, "1,3600"), p_options->metrics_flush_interval_sec, false);
+
+	_define_setting("sentry/options/minimal_crash_handling", p_options->minimal_crash_handling, false);
+	_define_setting("sentry/options/journal", p_options->journal, false);
+	_define_setting("sentry/options/async_init", p_options->async_init, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/shutdown_timeout_ms", PROPERTY_HINT_RANGE, "0,30000,1,suffix:ms"), p_options->shutdown_timeout_ms, false);
+	_define_setting("sentry/options/persist_on_shutdown", p_options->persist_on_shutdown, false);
+
+	_define_setting("sentry/options/transport/spooling", p_options->transport_spooling, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/transport/queue_size", PROPERTY_HINT_RANGE, "1,10000"), p_options->transport_queue_size, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/transport/workers", PROPERTY_HINT_RANGE, "1,8"), p_options->transport_workers, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/transport/compression", PROPERTY_HINT_ENUM, "None,Gzip,Zstd"), (int)p_options->envelope_compression, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/transport/compression_threshold", PROPERTY_HINT_RANGE, "0,1048576,1,suffix:B"), p_options->envelope_compression_threshold, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/transport/session_budget_kb", PROPERTY_HINT_RANGE, "0,1048576,1,suffix:KiB"), p_options->transport_session_budget_kb, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/options/transport/hourly_budget_kb", PROPERTY_HINT_RANGE, "0,1048576,1,suffix:KiB"), p_options->transport_hourly_budget_kb, false);
 
 	_define_setting("sentry/options/app_hang/tracking", p_options->app_hang_tracking, false);
 	_define_setting("sentry/options/app_hang/timeout_sec", p_options->app_hang_timeout_sec, false);
@@ -133,6 +156,10 @@ void SentryOptions::_define_project_settings(const Ref<SentryOptions> &p_options
 
 	_define_setting("sentry/experimental/attach_screenshot", p_options->attach_screenshot);
 	_define_setting(sentry::make_level_enum_property("sentry/experimental/screenshot_level"), p_options->screenshot_level, false);
+	_define_setting("sentry/experimental/scene_tree_mirror", p_options->scene_tree_mirror, false);
+	_define_setting("sentry/experimental/script_profiler", p_options->script_profiler, false);
+	_define_setting(PropertyInfo(Variant::INT, "sentry/experimental/script_profiler_interval_ms", PROPERTY_HINT_RANGE, "1,1000"), p_options->script_profiler_interval_ms, false);
+	_define_setting(PropertyInfo(Variant::FLOAT, "sentry/experimental/script_profiler_max_overhead", PROPERTY_HINT_RANGE, "0.1,10.0,0.1,suffix:%"), p_options->script_profiler_max_overhead, false);
 }
 
 void SentryOptions::_load_project_settings(const Ref<SentryOptions> &p_options) {
@@ -154,13 +181,36 @@ void SentryOptions::_load_project_settings(const Ref<SentryOptions> &p_options)
 	p_options->diagnostic_level = (sentry::Level)(int)ProjectSettings::get_singleton()->get_setting("sentry/options/diagnostic_level", p_options->diagnostic_level);
 
 	p_options->sample_rate = ProjectSettings::get_singleton()->get_setting("sentry/options/sample_rate", p_options->sample_rate);
+	p_options->traces_sample_rate = ProjectSettings::get_singleton()->get_setting("sentry/options/traces_sample_rate", p_options->traces_sample_rate);
+	p_options->trace_scene_changes = ProjectSettings::get_singleton()->get_setting("sentry/options/trace_scene_changes", p_options->trace_scene_changes);
+	p_options->trace_threaded_loads = ProjectSettings::get_singleton()->get_setting("sentry/options/trace_threaded_loads", p_options->trace_threaded_loads);
 	p_options->max_breadcrumbs = ProjectSettings::get_singleton()->get_setting("sentry/options/max_breadcrumbs", p_options->max_breadcrumbs);
 	p_options->send_default_pii = ProjectSettings::get_singleton()->get_setting("sentry/options/send_default_pii", p_options->send_default_pii);
 
 	p_options->attach_log = ProjectSettings::get_singleton()->get_setting("sentry/options/attach_log", p_options->attach_log);
 	p_options->attach_scene_tree = ProjectSettings::get_singleton()->get_setting("sentry/options/attach_scene_tree", p_options->attach_scene_tree);
+	p_options->scene_tree_max_nodes = ProjectSettings::get_singleton()->get_setting("sentry/options/scene_tree/max_nodes", p_options->scene_tree_max_nodes);
+	p_options->scene_tree_max_depth = ProjectSettings::get_singleton()->get_setting("sentry/options/scene_tree/max_depth", p_options->scene_tree_max_depth);
+	p_options->scene_tree_time_budget_ms = ProjectSettings::get_singleton()->get_setting("sentry/options/scene_tree/time_budget_ms", p_options->scene_tree_time_budget_ms);
+	p_options->processor_time_budget_ms = ProjectSettings::get_singleton()->get_setting("sentry/options/processor_time_budget_ms", p_options->processor_time_budget_ms);
 
 	p_options->enable_logs = ProjectSettings::get_singleton()->get_setting("sentry/options/enable_logs", p_options->enable_logs);
+	p_options->enable_metrics = ProjectSettings::get_singleton()->get_setting("sentry/options/enable_metrics", p_options->enable_metrics);
+	p_options->metrics_flush_interval_sec = ProjectSettings::get_singleton()->get_setting("sentry/options/metrics_flush_interval_sec", p_options->metrics_flush_interval_sec);
+
+	p_options->minimal_crash_handling = ProjectSettings::get_singleton()->get_setting("sentry/options/minimal_crash_handling", p_options->minimal_crash_handling);
+	p_options->journal = ProjectSettings::get_singleton()->get_setting("sentry/options/journal", p_options->journal);
+	p_options->async_init = ProjectSettings::get_singleton()->get_setting("sentry/options/async_init", p_options->async_init);
+	p_options->set_shutdown_timeout_ms(ProjectSettings::get_singleton()->get_setting("sentry/options/shutdown_timeout_ms", p_options->shutdown_timeout_ms));
+	p_options->persist_on_shutdown = ProjectSettings::get_singleton()->get_setting("sentry/options/persist_on_shutdown", p_options->persist_on_shutdown);
+
+	p_options->transport_spooling = ProjectSettings::get_singleton()->get_setting("sentry/options/transport/spooling", p_options->transport_spooling);
+	p_options->transport_queue_size = ProjectSettings::get_singleton()->get_setting("sentry/options/transport/queue_size", p_options->transport_queue_size);
+	p_options->transport_workers = ProjectSettings::get_singleton()->get_setting("sentry/options/transport/workers", p_options->transport_workers);
+	p_options->envelope_compression = (EnvelopeCompression)(int)ProjectSettings::get_singleton()->get_setting("sentry/options/transport/compression", (int)p_options->envelope_compression);
+	p_options->envelope_compression_threshold = ProjectSettings::get_singleton()->get_setting("sentry/options/transport/compression_threshold", p_options->envelope_compression_threshold);
+	p_options->transport_session_budget_kb = ProjectSettings::get_singleton()->get_setting("sentry/options/transport/session_budget_kb", p_options->transport_session_budget_kb);
+	p_options->transport_hourly_budget_kb = ProjectSettings::get_singleton()->get_setting("sentry/options/transport/hourly_budget_kb", p_options->transport_hourly_budget_kb);
 
 	p_options->app_hang_tracking = ProjectSettings::get_singleton()->get_setting("sentry/options/app_hang/tracking", p_options->app_hang_tracking);
 	p_options->app_hang_timeout_sec = ProjectSettings::get_singleton()->get_setting("sentry/options/app_hang/timeout_sec", p_options->app_hang_timeout_sec);
@@ -179,6 +229,10 @@ void SentryOptions::_load_project_settings(const Ref<SentryOptions> &p_options)
 
 	p_options->attach_screenshot = ProjectSettings::get_singleton()->get_setting("sentry/experimental/attach_screenshot", p_options->attach_screenshot);
 	p_options->screenshot_level = (sentry::Level)(int)ProjectSettings::get_singleton()->get_setting("sentry/experimental/screenshot_level", p_options->screenshot_level);
+	p_options->scene_tree_mirror = ProjectSettings::get_singleton()->get_setting("sentry/experimental/scene_tree_mirror", p_options->scene_tree_mirror);
+	p_options->script_profiler = ProjectSettings::get_singleton()->get_setting("sentry/experimental/script_profiler", p_options->script_profiler);
+	p_options->script_profiler_interval_ms = ProjectSettings::get_singleton()->get_setting("sentry/experimental/script_profiler_interval_ms", p_options->script_profiler_interval_ms);
+	p_options->script_profiler_max_overhead = ProjectSettings::get_singleton()->get_setting("sentry/experimental/script_profiler_max_overhead", p_options->script_profiler_max_overhead);
 }
 
 void SentryOptions::_init_debug_option(DebugMode p_mode) {
@@ -223,6 +277,7 @@ void SentryOptions::set_environment(const String &p_environment) {
 
 void SentryOptions::add_event_processor(const Ref<SentryEventProcessor> &p_processor) {
 	ERR_FAIL_COND(p_processor.is_null());
+	p_processor->stats_name = p_processor->get_class();
 	event_processors.push_back(p_processor);
 }
 
@@ -239,6 +294,9 @@ void SentryOptions::_bind_methods() {
 	BIND_PROPERTY(SentryOptions, sentry::make_level_enum_property("diagnostic_level"), set_diagnostic_level, get_diagnostic_level);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::STRING, "environment"), set_environment, get_environment);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::FLOAT, "sample_rate"), set_sample_rate, get_sample_rate);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::FLOAT, "traces_sample_rate"), set_traces_sample_rate, get_traces_sample_rate);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "trace_scene_changes"), set_trace_scene_changes, is_trace_scene_changes_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "trace_threaded_loads"), set_trace_threaded_loads, is_trace_threaded_loads_enabled);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "max_breadcrumbs"), set_max_breadcrumbs, get_max_breadcrumbs);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "send_default_pii"), set_send_default_pii, is_send_default_pii_enabled);
 
@@ -246,10 +304,35 @@ void SentryOptions::_bind_methods() {
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "attach_screenshot"), set_attach_screenshot, is_attach_screenshot_enabled);
 	BIND_PROPERTY(SentryOptions, sentry::make_level_enum_property("screenshot_level"), set_screenshot_level, get_screenshot_level);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "attach_scene_tree"), set_attach_scene_tree, is_attach_scene_tree_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "scene_tree_mirror"), set_scene_tree_mirror, is_scene_tree_mirror_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "scene_tree_max_nodes"), set_scene_tree_max_nodes, get_scene_tree_max_nodes);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "script_profiler"), set_script_profiler, is_script_profiler_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "script_profiler_interval_ms"), set_script_profiler_interval_ms, get_script_profiler_interval_ms);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::FLOAT, "script_profiler_max_overhead"), set_script_profiler_max_overhead, get_script_profiler_max_overhead);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "scene_tree_max_depth"), set_scene_tree_max_depth, get_scene_tree_max_depth);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "scene_tree_time_budget_ms"), set_scene_tree_time_budget_ms, get_scene_tree_time_budget_ms);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "processor_time_budget_ms"), set_processor_time_budget_ms, get_processor_time_budget_ms);
 
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "enable_logs"), set_enable_logs, get_enable_logs);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "enable_metrics"), set_enable_metrics, get_enable_metrics);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "metrics_flush_interval_sec"), set_metrics_flush_interval_sec, get_metrics_flush_interval_sec);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::CALLABLE, "before_send_log"), set_before_send_log, get_before_send_log);
 
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "minimal_crash_handling"), set_minimal_crash_handling, is_minimal_crash_handling_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "journal"), set_journal, is_journal_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "async_init"), set_async_init, is_async_init_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "shutdown_timeout_ms"), set_shutdown_timeout_ms, get_shutdown_timeout_ms);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "persist_on_shutdown"), set_persist_on_shutdown, is_persist_on_shutdown_enabled);
+
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "transport_spooling"), set_transport_spooling, is_transport_spooling_enabled);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "transport_queue_size"), set_transport_queue_size, get_transport_queue_size);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "transport_workers"), set_transport_workers, get_transport_workers);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "envelope_compression", PROPERTY_HINT_ENUM, "None,Gzip,Zstd"), set_envelope_compression, get_envelope_compression);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "envelope_compression_threshold"), set_envelope_compression_threshold, get_envelope_compression_threshold);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "transport_session_budget_kb"), set_transport_session_budget_kb, get_transport_session_budget_kb);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::INT, "transport_hourly_budget_kb"), set_transport_hourly_budget_kb, get_transport_hourly_budget_kb);
+	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::OBJECT, "transport", PROPERTY_HINT_TYPE_STRING, "SentryTransport", PROPERTY_USAGE_NONE), set_transport, get_transport);
+
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::BOOL, "app_hang_tracking"), set_app_hang_tracking, is_app_hang_tracking_enabled);
 	BIND_PROPERTY(SentryOptions, PropertyInfo(Variant::FLOAT, "app_hang_timeout_sec"), set_app_hang_timeout_sec, get_app_hang_timeout_sec);
 
@@ -274,6 +357,10 @@ void SentryOptions::_bind_methods() {
 		BIND_BITFIELD_FLAG(MASK_SCRIPT);
 		BIND_BITFIELD_FLAG(MASK_SHADER);
 	}
+
+	BIND_ENUM_CONSTANT(COMPRESSION_NONE);
+	BIND_ENUM_CONSTANT(COMPRESSION_GZIP);
+	BIND_ENUM_CONSTANT(COMPRESSION_ZSTD);
 }
 
 SentryOptions::SentryOptions() {
@@ -4,6 +4,7 @@
 #include "sentry/godot_error_types.h"
 #include "sentry/level.h"
 #include "sentry/processing/sentry_event_processor.h"
+#include "sentry/sentry_transport.h"
 #include "sentry/util/simple_bind.h"
 
 #include <godot_cpp/classes/ref_counted.hpp>
@@ -61,6 +62,12 @@ public:
 	using GodotErrorType = sentry::GodotErrorType;
 	using GodotErrorMask = sentry::GodotErrorMask;
 
+	enum EnvelopeCompression {
+		COMPRESSION_NONE = 0,
+		COMPRESSION_GZIP = 1,
+		COMPRESSION_ZSTD = 2,
+	};
+
 private:
 	enum class DebugMode {
 		DEBUG_OFF = 0,
@@ -78,6 +85,9 @@ private:
 	sentry::Level diagnostic_level = sentry::LEVEL_DEBUG;
 	String environment = "{auto}";
 	double sample_rate = 1.0;
+	double traces_sample_rate = 0.0;
+	bool trace_scene_changes = false;
+	bool trace_threaded_loads = false;
 	int max_breadcrumbs = 100;
 	bool send_default_pii = false;
 
@@ -85,10 +95,36 @@ private:
 	bool attach_screenshot = false;
 	sentry::Level screenshot_level = sentry::LEVEL_FATAL;
 	bool attach_scene_tree = false;
+	bool scene_tree_mirror = false;
+	bool script_profiler = false;
+	int script_profiler_interval_ms = 10;
+	double script_profiler_max_overhead = 1.0;
+	int scene_tree_max_nodes = 20'000;
+	int scene_tree_max_depth = 128;
+	int scene_tree_time_budget_ms = 20;
+	int processor_time_budget_ms = 0;
 
 	bool enable_logs = false;
 	Callable before_send_log;
 
+	bool enable_metrics = false;
+	int metrics_flush_interval_sec = 10;
+
+	bool minimal_crash_handling = false;
+	bool journal = false;
+	bool async_init = false;
+	int shutdown_timeout_ms = 2000;
+	bool persist_on_shutdown = false;
+
+	bool transport_spooling = false;
+	int transport_queue_size = 100;
+	int transport_workers = 1;
+	EnvelopeCompression envelope_compression = COMPRESSION_GZIP;
+	int envelope_compression_threshold = 1024;
+	int transport_session_budget_kb = 0;
+	int transport_hourly_budget_kb = 0;
+	Ref<SentryTransport> transport;
+
 	bool app_hang_tracking = false;
 	double app_hang_timeout_sec = 5.0;
 
@@ -143,7 +179,16 @@ public:
 	_FORCE_INLINE_ sentry::Level get_diagnostic_level() const { return diagnostic_level; }
 
 	_FORCE_INLINE_ double get_sample_rate() const { return sample_rate; }
-	_FORCE_INLINE_ void set_sample_rate(double p_sample_rate) { sample_rate = p_sample_rate; }
+	_FORCE_INLINE_ void set_sample_rate(double p_sample_rate) { sample_rate = CLAMP(p_sample_rate, 0.0, 1.0); }
+
+	_FORCE_INLINE_ double get_traces_sample_rate() const { return traces_sample_rate; }
+	_FORCE_INLINE_ void set_traces_sample_rate(double p_traces_sample_rate) { traces_sample_rate = CLAMP(p_traces_sample_rate, 0.0, 1.0); }
+
+	_FORCE_INLINE_ bool is_trace_scene_changes_enabled() const { return trace_scene_changes; }
+	_FORCE_INLINE_ void set_trace_scene_changes(bool p_enabled) { trace_scene_changes = p_enabled; }
+
+	_FORCE_INLINE_ bool is_trace_threaded_loads_enabled() const { return trace_threaded_loads; }
+	_FORCE_INLINE_ void set_trace_threaded_loads(bool p_enabled) { trace_threaded_loads = p_enabled; }
 
 	_FORCE_INLINE_ int get_max_breadcrumbs() const { return max_breadcrumbs; }
 	_FORCE_INLINE_ void set_max_breadcrumbs(int p_max_breadcrumbs) { max_breadcrumbs = p_max_breadcrumbs; }
@@ -163,12 +208,81 @@ public:
 	_FORCE_INLINE_ void set_attach_scene_tree(bool p_enable) { attach_scene_tree = p_enable; }
 	_FORCE_INLINE_ bool is_attach_scene_tree_enabled() const { return attach_scene_tree; }
 
+	_FORCE_INLINE_ void set_scene_tree_mirror(bool p_enable) { scene_tree_mirror = p_enable; }
+	_FORCE_INLINE_ bool is_scene_tree_mirror_enabled() const { return scene_tree_mirror; }
+
+	_FORCE_INLINE_ void set_script_profiler(bool p_enable) { script_profiler = p_enable; }
+	_FORCE_INLINE_ bool is_script_profiler_enabled() const { return script_profiler; }
+
+	_FORCE_INLINE_ int get_script_profiler_interval_ms() const { return script_profiler_interval_ms; }
+	_FORCE_INLINE_ void set_script_profiler_interval_ms(int p_interval_ms) { script_profiler_interval_ms = p_interval_ms; }
+
+	_FORCE_INLINE_ double get_script_profiler_max_overhead() const { return script_profiler_max_overhead; }
+	_FORCE_INLINE_ void set_script_profiler_max_overhead(double p_max_overhead) { script_profiler_max_overhead = p_max_overhead; }
+
+	_FORCE_INLINE_ int get_scene_tree_max_nodes() const { return scene_tree_max_nodes; }
+	_FORCE_INLINE_ void set_scene_tree_max_nodes(int p_max_nodes) { scene_tree_max_nodes = p_max_nodes; }
+
+	_FORCE_INLINE_ int get_scene_tree_max_depth() const { return scene_tree_max_depth; }
+	_FORCE_INLINE_ void set_scene_tree_max_depth(int p_max_depth) { scene_tree_max_depth = p_max_depth; }
+
+	_FORCE_INLINE_ int get_scene_tree_time_budget_ms() const { return scene_tree_time_budget_ms; }
+	_FORCE_INLINE_ void set_scene_tree_time_budget_ms(int p_milliseconds) { scene_tree_time_budget_ms = p_milliseconds; }
+
+	_FORCE_INLINE_ int get_processor_time_budget_ms() const { return processor_time_budget_ms; }
+	_FORCE_INLINE_ void set_processor_time_budget_ms(int p_milliseconds) { processor_time_budget_ms = p_milliseconds; }
+
 	_FORCE_INLINE_ bool get_enable_logs() const { return enable_logs; }
 	_FORCE_INLINE_ void set_enable_logs(bool p_enabled) { enable_logs = p_enabled; }
 
+	_FORCE_INLINE_ bool get_enable_metrics() const { return enable_metrics; }
+	_FORCE_INLINE_ void set_enable_metrics(bool p_enabled) { enable_metrics = p_enabled; }
+
+	_FORCE_INLINE_ int get_metrics_flush_interval_sec() const { return metrics_flush_interval_sec; }
+	_FORCE_INLINE_ void set_metrics_flush_interval_sec(int p_interval_sec) { metrics_flush_interval_sec = p_interval_sec; }
+
 	_FORCE_INLINE_ Callable get_before_send_log() const { return before_send_log; }
 	_FORCE_INLINE_ void set_before_send_log(const Callable &p_callback) { before_send_log = p_callback; }
 
+	_FORCE_INLINE_ bool is_minimal_crash_handling_enabled() const { return minimal_crash_handling; }
+	_FORCE_INLINE_ void set_minimal_crash_handling(bool p_enabled) { minimal_crash_handling = p_enabled; }
+
+	_FORCE_INLINE_ bool is_journal_enabled() const { return journal; }
+	_FORCE_INLINE_ void set_journal(bool p_enabled) { journal = p_enabled; }
+
+	_FORCE_INLINE_ bool is_async_init_enabled() const { return async_init; }
+	_FORCE_INLINE_ void set_async_init(bool p_enabled) { async_init = p_enabled; }
+
+	_FORCE_INLINE_ int get_shutdown_timeout_ms() const { return shutdown_timeout_ms; }
+	_FORCE_INLINE_ void set_shutdown_timeout_ms(int p_timeout_ms) { shutdown_timeout_ms = MAX(0, p_timeout_ms); }
+
+	_FORCE_INLINE_ bool is_persist_on_shutdown_enabled() const { return persist_on_shutdown; }
+	_FORCE_INLINE_ void set_persist_on_shutdown(bool p_enabled) { persist_on_shutdown = p_enabled; }
+
+	_FORCE_INLINE_ bool is_transport_spooling_enabled() const { return transport_spooling; }
+	_FORCE_INLINE_ void set_transport_spooling(bool p_enabled) { transport_spooling = p_enabled; }
+
+	_FORCE_INLINE_ int get_transport_queue_size() const { return transport_queue_size; }
+	_FORCE_INLINE_ void set_transport_queue_size(int p_size) { transport_queue_size = p_size; }
+
+	_FORCE_INLINE_ int get_transport_workers() const { return transport_workers; }
+	_FORCE_INLINE_ void set_transport_workers(int p_workers) { transport_workers = p_workers; }
+
+	_FORCE_INLINE_ EnvelopeCompression get_envelope_compression() const { return envelope_compression; }
+	_FORCE_INLINE_ void set_envelope_compression(EnvelopeCompression p_compression) { envelope_compression = p_compression; }
+
+	_FORCE_INLINE_ int get_envelope_compression_threshold() const { return envelope_compression_threshold; }
+	_FORCE_INLINE_ void set_envelope_compression_threshold(int p_bytes) { envelope_compression_threshold = p_bytes; }
+
+	_FORCE_INLINE_ int get_transport_session_budget_kb() const { return transport_session_budget_kb; }
+	_FORCE_INLINE_ void set_transport_session_budget_kb(int p_kb) { transport_session_budget_kb = p_kb; }
+
+	_FORCE_INLINE_ int get_transport_hourly_budget_kb() const { return transport_hourly_budget_kb; }
+	_FORCE_INLINE_ void set_transport_hourly_budget_kb(int p_kb) { transport_hourly_budget_kb = p_kb; }
+
+	_FORCE_INLINE_ Ref<SentryTransport> get_transport() const { return transport; }
+	_FORCE_INLINE_ void set_transport(const Ref<SentryTransport> &p_transport) { transport = p_transport; }
+
 	_FORCE_INLINE_ bool is_app_hang_tracking_enabled() const { return app_hang_tracking; }
 	_FORCE_INLINE_ void set_app_hang_tracking(bool p_enabled) { app_hang_tracking = p_enabled; }
 
@@ -218,5 +332,6 @@ public:
 } // namespace sentry
 
 VARIANT_BITFIELD_CAST(sentry::SentryOptions::GodotErrorMask);
+VARIANT_ENUM_CAST(sentry::SentryOptions::EnvelopeCompression);
 
 #endif // SENTRY_OPTIONS_H
@@ -1,15 +1,24 @@
 #include "sentry_sdk.h"
 
 #include "gen/sdk_version.gen.h"
+#include "sentry/auto_tracing.h"
 #include "sentry/common_defs.h"
 #include "sentry/contexts.h"
 #include "sentry/disabled/disabled_sdk.h"
+#include "sentry/disabled/disabled_transaction.h"
 #include "sentry/godot_singletons.h"
 #include "sentry/logging/print.h"
+#include "sentry/metrics.h"
+#include "sentry/options_snapshot.h"
+#include "sentry/processing/processing_stats.h"
 #include "sentry/processing/screenshot_processor.h"
 #include "sentry/processing/view_hierarchy_processor.h"
+#include "sentry/sampling.h"
+#include "sentry/script_profiler.h"
 #include "sentry/sentry_attachment.h"
 #include "sentry/sentry_options.h"
+#include "sentry/telemetry.h"
+#include "sentry/thread_locations.h"
 #include "sentry/util/simple_bind.h"
 
 #include <godot_cpp/classes/dir_access.hpp>
@@ -134,6 +143,7 @@ void SentrySDK::init(const Callable &p_configuration_callback) {
 
 	// Fresh options from project settings.
 	options = SentryOptions::create_from_project_settings();
+	sentry::options_snapshot::publish(options.ptr());
 
 	// Add built-in event processors.
 	if (options->is_attach_screenshot_enabled()) {
@@ -147,12 +157,23 @@ void SentrySDK::init(const Callable &p_configuration_callback) {
 	internal_sdk->init(_get_global_attachments(), p_configuration_callback);
 
 	if (internal_sdk->is_enabled()) {
-		if (is_auto_initializing) {
+		if (is_auto_initializing || options->is_async_init_enabled()) {
 			// Delay contexts initialization until engine singletons are ready during early initialization.
+			// With async init, it's also left for later, so that the first frame isn't delayed by it.
 			callable_mp(this, &SentrySDK::_init_contexts).call_deferred();
+			callable_mp_static(&sentry::telemetry::register_monitors).call_deferred();
+			sentry::telemetry::start_debugger_stream();
+			sentry::auto_tracing::start();
+			sentry::script_profiler::start();
+			sentry::metrics::start();
 		} else {
 			// TODO: move this into sentry::contexts
 			_init_contexts();
+			sentry::telemetry::register_monitors();
+			sentry::telemetry::start_debugger_stream();
+			sentry::auto_tracing::start();
+			sentry::script_profiler::start();
+			sentry::metrics::start();
 		}
 
 		if (options->is_logger_enabled()) {
@@ -171,29 +192,59 @@ void SentrySDK::close() {
 			OS::get_singleton()->remove_logger(godot_logger);
 			godot_logger.unref();
 		}
+		sentry::metrics::stop();
 		internal_sdk->close();
+		sentry::telemetry::unregister_monitors();
+		sentry::telemetry::stop_debugger_stream();
+		sentry::auto_tracing::stop();
+		sentry::script_profiler::stop();
 	}
 }
 
+bool SentrySDK::flush(int p_timeout_ms) {
+	ERR_FAIL_COND_V_MSG(p_timeout_ms < 0, false, "Sentry: Flush timeout can't be negative.");
+	if (!internal_sdk->is_enabled()) {
+		return false;
+	}
+	return internal_sdk->flush(p_timeout_ms);
+}
+
 String SentrySDK::capture_message(const String &p_message, Level p_level) {
+	sentry::script_profiler::sample_point();
+	if (!sentry::sampling::sample_event()) {
+		sentry::logging::print_debug("Message event sampled out");
+		return String();
+	}
+	sentry::sampling::SampledCaptureScope sampled;
 	return internal_sdk->capture_message(p_message, p_level);
 }
 
 void SentrySDK::add_breadcrumb(const Ref<SentryBreadcrumb> &p_breadcrumb) {
+	sentry::script_profiler::sample_point();
 	ERR_FAIL_COND_MSG(p_breadcrumb.is_null(), "Sentry: Can't add null breadcrumb.");
 	internal_sdk->add_breadcrumb(p_breadcrumb);
+	sentry::telemetry::add(sentry::telemetry::BREADCRUMBS_ADDED);
 }
 
 String SentrySDK::get_last_event_id() const {
 	return internal_sdk->get_last_event_id();
 }
 
+Dictionary SentrySDK::get_processing_stats() const {
+	return sentry::processing_stats::get_stats();
+}
+
 Ref<SentryEvent> SentrySDK::create_event() const {
 	return internal_sdk->create_event();
 }
 
 String SentrySDK::capture_event(const Ref<SentryEvent> &p_event) {
 	ERR_FAIL_COND_V_MSG(p_event.is_null(), "", "Sentry: Can't capture event - event object is null.");
+	if (!sentry::sampling::sample_event()) {
+		sentry::logging::print_debug("Event sampled out");
+		return String();
+	}
+	sentry::sampling::SampledCaptureScope sampled;
 	return internal_sdk->capture_event(p_event);
 }
 
@@ -211,6 +262,47 @@ void SentrySDK::add_attachment(const Ref<SentryAttachment> &p_attachment) {
 	internal_sdk->add_attachment(p_attachment);
 }
 
+void SentrySDK::set_thread_label(const String &p_label) {
+	sentry::thread_locations::set_label(p_label);
+}
+
+Ref<SentryTransaction> SentrySDK::start_transaction(const String &p_name, const String &p_operation) {
+	sentry::script_profiler::sample_point();
+	ERR_FAIL_COND_V_MSG(p_name.is_empty(), noop_transaction, "Sentry: Can't start transaction with an empty name.");
+	if (!internal_sdk->is_enabled() || !sentry::sampling::sample(sentry::options_snapshot::get()->traces_sample_rate)) {
+		return noop_transaction;
+	}
+	Ref<SentryTransaction> transaction = internal_sdk->start_transaction(p_name, p_operation);
+	return transaction.is_valid() ? transaction : noop_transaction;
+}
+
+void SentrySDK::update_limits(const Ref<SentryLoggerLimits> &p_limits) {
+	ERR_FAIL_COND_MSG(p_limits.is_null(), "Sentry: Can't update limits - limits object is null.");
+	// Copied, so that later changes to the object don't take effect without another update.
+	// Negative values are meaningless, and are clamped like project settings are.
+	Ref<SentryLoggerLimits> limits;
+	limits.instantiate();
+	limits->events_per_frame = MAX(0, p_limits->events_per_frame);
+	limits->repeated_error_window_ms = MAX(0, p_limits->repeated_error_window_ms);
+	limits->throttle_events = MAX(0, p_limits->throttle_events);
+	limits->throttle_window_ms = MAX(0, p_limits->throttle_window_ms);
+	options->set_logger_limits(limits);
+	sentry::options_snapshot::publish(options.ptr());
+	sentry::logging::print_debug("Logger limits updated");
+}
+
+void SentrySDK::update_sampling(double p_sample_rate, double p_traces_sample_rate) {
+	options->set_sample_rate(p_sample_rate);
+	options->set_traces_sample_rate(p_traces_sample_rate);
+	sentry::options_snapshot::publish(options.ptr());
+	sentry::logging::print_debug(vformat("Sampling updated: sample_rate=%f traces_sample_rate=%f",
+			options->get_sample_rate(), options->get_traces_sample_rate()));
+}
+
+Dictionary SentrySDK::get_script_profile() const {
+	return sentry::script_profiler::make_profile(0, UINT64_MAX);
+}
+
 void SentrySDK::set_tag(const String &p_key, const String &p_value) {
 	ERR_FAIL_COND_MSG(p_key.is_empty(), "Sentry: Can't set tag with an empty key.");
 	internal_sdk->set_tag(p_key, p_value);
@@ -268,6 +360,9 @@ PackedStringArray SentrySDK::_get_global_attachments() {
 		}
 	}
 
+	// NOTE: Screenshot and view hierarchy are passed as in-memory event attachments where the backend
+	//       supports it. These files serve as a fallback for crash events and other backends.
+
 	// Attach screenshot.
 	if (options->is_attach_screenshot_enabled()) {
 		String screenshot_path = OS::get_singleton()->get_user_data_dir().path_join(SENTRY_SCREENSHOT_FN);
@@ -401,9 +496,11 @@ void SentrySDK::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("init", "configuration_callback"), &SentrySDK::init, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("close"), &SentrySDK::close);
 	ClassDB::bind_method(D_METHOD("is_enabled"), &SentrySDK::is_enabled);
+	ClassDB::bind_method(D_METHOD("flush", "timeout_ms"), &SentrySDK::flush, DEFVAL(2000));
 	ClassDB::bind_method(D_METHOD("add_breadcrumb", "breadcrumb"), &SentrySDK::add_breadcrumb);
 	ClassDB::bind_method(D_METHOD("capture_message", "message", "level"), &SentrySDK::capture_message, DEFVAL(LEVEL_INFO));
 	ClassDB::bind_method(D_METHOD("get_last_event_id"), &SentrySDK::get_last_event_id);
+	ClassDB::bind_method(D_METHOD("get_processing_stats"), &SentrySDK::get_processing_stats);
 	ClassDB::bind_method(D_METHOD("set_context", "key", "value"), &SentrySDK::set_context);
 	ClassDB::bind_method(D_METHOD("set_tag", "key", "value"), &SentrySDK::set_tag);
 	ClassDB::bind_method(D_METHOD("remove_tag", "key"), &SentrySDK::remove_tag);
@@ -413,31 +510,44 @@ void SentrySDK::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("capture_event", "event"), &SentrySDK::capture_event);
 	ClassDB::bind_method(D_METHOD("capture_feedback", "feedback"), &SentrySDK::capture_feedback);
 	ClassDB::bind_method(D_METHOD("add_attachment", "attachment"), &SentrySDK::add_attachment);
+	ClassDB::bind_method(D_METHOD("set_thread_label", "label"), &SentrySDK::set_thread_label);
+	ClassDB::bind_method(D_METHOD("start_transaction", "name", "operation"), &SentrySDK::start_transaction);
+	ClassDB::bind_method(D_METHOD("update_limits", "limits"), &SentrySDK::update_limits);
+	ClassDB::bind_method(D_METHOD("update_sampling", "sample_rate", "traces_sample_rate"), &SentrySDK::update_sampling);
 
 	// Hidden API methods -- used in testing.
 	ClassDB::bind_method(D_METHOD("_set_before_send", "callable"), &SentrySDK::set_before_send);
 	ClassDB::bind_method(D_METHOD("_unset_before_send"), &SentrySDK::unset_before_send);
 	ClassDB::bind_method(D_METHOD("_get_before_send"), &SentrySDK::get_before_send);
+	ClassDB::bind_method(D_METHOD("_get_script_profile"), &SentrySDK::get_script_profile);
 	ClassDB::bind_method(D_METHOD("_demo_helper_crash_app"), &SentrySDK::_demo_helper_crash_app);
 
 	BIND_PROPERTY_READONLY(SentrySDK, PropertyInfo(Variant::OBJECT, "logger", PROPERTY_HINT_TYPE_STRING, "SentryLogger", PROPERTY_USAGE_NONE), get_logger);
+	BIND_PROPERTY_READONLY(SentrySDK, PropertyInfo(Variant::OBJECT, "metrics", PROPERTY_HINT_TYPE_STRING, "SentryMetrics", PROPERTY_USAGE_NONE), get_metrics);
 }
 
 SentrySDK::SentrySDK() {
 	ERR_FAIL_NULL(OS::get_singleton());
 
 	options = SentryOptions::create_from_project_settings();
+	sentry::options_snapshot::publish(options.ptr());
 	logger = memnew(SentryLogger);
+	metrics = memnew(SentryMetrics);
+	noop_transaction = Ref(memnew(DisabledTransaction));
 	internal_sdk = std::make_unique<DisabledSDK>();
 }
 
 SentrySDK::~SentrySDK() {
 	internal_sdk.reset();
+	noop_transaction.unref();
 
 	singleton = nullptr;
 
 	memdelete(logger);
 	logger = nullptr;
+
+	memdelete(metrics);
+	metrics = nullptr;
 }
 
 } // namespace sentry
@@ -9,7 +9,9 @@
 #include "sentry/sentry_breadcrumb.h"
 #include "sentry/sentry_event.h"
 #include "sentry/sentry_logger.h"
+#include "sentry/sentry_metrics.h"
 #include "sentry/sentry_options.h"
+#include "sentry/sentry_transaction.h"
 
 #include <godot_cpp/classes/mutex.hpp>
 #include <godot_cpp/core/object.hpp>
@@ -39,9 +41,15 @@ private:
 	Ref<sentry::logging::SentryGodotLogger> godot_logger;
 	bool is_auto_initializing = false;
 
+	// Shared no-op transaction, returned when tracing is off or a transaction is sampled out.
+	Ref<SentryTransaction> noop_transaction;
+
 	// Public API logs interface
 	SentryLogger *logger = nullptr;
 
+	// Public API metrics interface
+	SentryMetrics *metrics = nullptr;
+
 	void _init_contexts();
 	void _init_user();
 	PackedStringArray _get_global_attachments();
@@ -58,7 +66,7 @@ public:
 	static void destroy_singleton();
 	static SentrySDK *get_singleton() { return singleton; }
 
-	_FORCE_INLINE_ Ref<SentryOptions> get_options() const { return options; }
+	_FORCE_INLINE_ const Ref<SentryOptions> &get_options() const { return options; }
 	_FORCE_INLINE_ sentry::InternalSDK *get_internal_sdk() const { return internal_sdk.get(); }
 	_FORCE_INLINE_ Ref<RuntimeConfig> get_runtime_config() const { return runtime_config; }
 
@@ -67,6 +75,7 @@ public:
 	void init(const Callable &p_configuration_callback = Callable());
 	void close();
 	bool is_enabled() const { return internal_sdk->is_enabled(); }
+	bool flush(int p_timeout_ms);
 
 	void add_breadcrumb(const Ref<SentryBreadcrumb> &p_breadcrumb);
 
@@ -79,9 +88,11 @@ public:
 	void remove_user();
 
 	_FORCE_INLINE_ SentryLogger *get_logger() const { return logger; }
+	_FORCE_INLINE_ SentryMetrics *get_metrics() const { return metrics; }
 
 	String capture_message(const String &p_message, sentry::Level p_level = sentry::LEVEL_INFO);
 	String get_last_event_id() const;
+	Dictionary get_processing_stats() const;
 
 	Ref<SentryEvent> create_event() const;
 	String capture_event(const Ref<SentryEvent> &p_event);
@@ -90,11 +101,19 @@ public:
 
 	void add_attachment(const Ref<SentryAttachment> &p_attachment);
 
+	void set_thread_label(const String &p_label);
+
+	Ref<SentryTransaction> start_transaction(const String &p_name, const String &p_operation);
+
+	void update_limits(const Ref<SentryLoggerLimits> &p_limits);
+	void update_sampling(double p_sample_rate, double p_traces_sample_rate);
+
 	// * Hidden API methods -- used in testing
 
 	void set_before_send(const Callable &p_callable) { options->set_before_send(p_callable); }
 	void unset_before_send() { options->set_before_send(Callable()); }
 	Callable get_before_send() { return options->get_before_send(); }
+	Dictionary get_script_profile() const;
 
 	void prepare_and_auto_initialize();
 
@@ -0,0 +1,12 @@
+#include "sentry_span.h"
+
+namespace sentry {
+
+void SentrySpan::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("start_child", "operation", "description"), &SentrySpan::start_child, DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("set_data", "key", "value"), &SentrySpan::set_data);
+	ClassDB::bind_method(D_METHOD("finish"), &SentrySpan::finish);
+	ClassDB::bind_method(D_METHOD("is_finished"), &SentrySpan::is_finished);
+}
+
+} //namespace sentry
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <godot_cpp/classes/ref_counted.hpp>
+
+using namespace godot;
+
+namespace sentry {
+
+// Represents a timed operation in the performance monitoring API.
+class SentrySpan : public RefCounted {
+	GDCLASS(SentrySpan, RefCounted);
+
+protected:
+	static void _bind_methods();
+
+public:
+	virtual Ref<SentrySpan> start_child(const String &p_operation, const String &p_description = "") = 0;
+
+	virtual void set_data(const String &p_key, const Variant &p_value) = 0;
+
+	virtual void finish() = 0;
+	virtual bool is_finished() const = 0;
+
+	virtual ~SentrySpan() = default;
+};
+
+} //namespace sentry
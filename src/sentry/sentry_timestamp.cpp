@@ -3,68 +3,102 @@
 #include "sentry/logging/print.h"
 #include "sentry/util/simple_bind.h"
 
-#include <cstdio>
-#include <cstring>
-#include <ctime>
+#include <cmath>
+
+namespace {
+
+// Reads exactly p_count decimal digits. Returns -1 if any of them isn't a digit.
+// Stops at the first non-digit, so it never reads past the terminating null.
+inline int _parse_digits(const char *p_str, int p_count) {
+	int value = 0;
+	for (int i = 0; i < p_count; i++) {
+		unsigned int digit = (unsigned char)p_str[i] - '0';
+		if (digit > 9) {
+			return -1;
+		}
+		value = value * 10 + (int)digit;
+	}
+	return value;
+}
+
+// Writes p_value as exactly p_count decimal digits, zero-padded.
+inline void _write_digits(char *r_out, int64_t p_value, int p_count) {
+	for (int i = p_count - 1; i >= 0; i--) {
+		r_out[i] = char('0' + p_value % 10);
+		p_value /= 10;
+	}
+}
+
+inline int64_t _floor_div(int64_t p_a, int64_t p_b) {
+	return (p_a >= 0 ? p_a : p_a - (p_b - 1)) / p_b;
+}
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar (H. Hinnant's days_from_civil).
+inline int64_t _days_from_civil(int64_t p_year, int p_month, int p_day) {
+	p_year -= p_month <= 2;
+	const int64_t era = _floor_div(p_year, 400);
+	const int64_t yoe = p_year - era * 400;
+	const int64_t doy = (153 * (p_month > 2 ? p_month - 3 : p_month + 9) + 2) / 5 + p_day - 1;
+	const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146'097 + doe - 719'468;
+}
 
-#ifdef WINDOWS_ENABLED
-#include <time.h>
-#endif
+} // unnamed namespace
 
 namespace sentry {
 
-Ref<SentryTimestamp> SentryTimestamp::parse_rfc3339_cstr(const char *p_formatted_cstring) {
+bool SentryTimestamp::parse_rfc3339_usec(const char *p_formatted_cstring, int64_t &r_microseconds) {
 	if (p_formatted_cstring == NULL) {
-		return Ref<SentryTimestamp>();
+		return false;
 	}
 
+	// YYYY-MM-DDTHH:MM:SS
 	const char *cur = p_formatted_cstring;
-
-	size_t len = strlen(p_formatted_cstring);
-	if (len < 20) {
-		return Ref<SentryTimestamp>();
-	}
-
-	int year, month, day, hour, minute, second = 0;
-	int64_t nanos = 0;
-
-	int num_consumed = 0;
-	constexpr int num_inputs = 6;
-	constexpr int num_chars_in_date = 19;
-	if (sscanf(cur, "%4d-%2d-%2dT%2d:%2d:%2d%n", &year, &month, &day, &hour, &minute, &second, &num_consumed) < num_inputs || num_consumed != num_chars_in_date) {
-		return Ref<SentryTimestamp>();
+	const int year = _parse_digits(cur, 4);
+	const int month = year < 0 || cur[4] != '-' ? -1 : _parse_digits(cur + 5, 2);
+	const int day = month < 0 || cur[7] != '-' ? -1 : _parse_digits(cur + 8, 2);
+	const int hour = day < 0 || cur[10] != 'T' ? -1 : _parse_digits(cur + 11, 2);
+	const int minute = hour < 0 || cur[13] != ':' ? -1 : _parse_digits(cur + 14, 2);
+	const int second = minute < 0 || cur[16] != ':' ? -1 : _parse_digits(cur + 17, 2);
+	if (second < 0 || cur[19] == '\0') {
+		return false;
 	}
+	cur += 19;
 
-	cur += num_consumed;
-
-	FAIL_COND_V_PRINT_ERROR(year < 1900 || year > 9999, Ref<SentryTimestamp>(), "Invalid timestamp year");
-	FAIL_COND_V_PRINT_ERROR(month < 1 || month > 12, Ref<SentryTimestamp>(), "Invalid timestamp month");
-	FAIL_COND_V_PRINT_ERROR(day < 1 || day > 31, Ref<SentryTimestamp>(), "Invalid timestamp day");
-	FAIL_COND_V_PRINT_ERROR(hour < 0 || hour > 23, Ref<SentryTimestamp>(), "Invalid timestamp hour");
-	FAIL_COND_V_PRINT_ERROR(minute < 0 || minute > 59, Ref<SentryTimestamp>(), "Invalid timestamp minute");
-	FAIL_COND_V_PRINT_ERROR(second < 0 || second > 59, Ref<SentryTimestamp>(), "Invalid timestamp second");
+	FAIL_COND_V_PRINT_ERROR(month < 1 || month > 12, false, "Invalid timestamp month");
+	FAIL_COND_V_PRINT_ERROR(day < 1 || day > 31, false, "Invalid timestamp day");
+	FAIL_COND_V_PRINT_ERROR(hour > 23, false, "Invalid timestamp hour");
+	FAIL_COND_V_PRINT_ERROR(minute > 59, false, "Invalid timestamp minute");
+	FAIL_COND_V_PRINT_ERROR(second > 59, false, "Invalid timestamp second");
 
 	if (month == 2) {
 		int max_day = ((year % 4 == 0 && year % 100 != 0) || (year % 400 == 0)) ? 29 : 28;
-		FAIL_COND_V_PRINT_ERROR(day > max_day, Ref<SentryTimestamp>(), "Invalid timestamp day for February");
+		FAIL_COND_V_PRINT_ERROR(day > max_day, false, "Invalid timestamp day for February");
 	} else if (month == 4 || month == 6 || month == 9 || month == 11) {
-		FAIL_COND_V_PRINT_ERROR(day > 30, Ref<SentryTimestamp>(), "Invalid timestamp day for month");
+		FAIL_COND_V_PRINT_ERROR(day > 30, false, "Invalid timestamp day for month");
 	}
 
+	int64_t micros = 0;
 	if (cur[0] == '.') {
-		int32_t fractional = 0;
-		if (sscanf(cur, ".%9d%n", &fractional, &num_consumed) < 1 || num_consumed > 10) {
+		// Up to 9 digits; digits beyond microseconds are truncated.
+		int num_digits = 0;
+		for (; num_digits < 9; num_digits++) {
+			const unsigned int digit = (unsigned char)cur[1 + num_digits] - '0';
+			if (digit > 9) {
+				break;
+			}
+			if (num_digits < 6) {
+				micros = micros * 10 + digit;
+			}
+		}
+		if (num_digits == 0) {
 			sentry::logging::print_error("Timestamp parsing needs 1-9 fractional digits.");
-			return Ref<SentryTimestamp>();
+			return false;
 		}
-		cur += num_consumed;
-
-		// normalize to nanoseconds
-		int missing_digits = 10 - num_consumed;
-		while (missing_digits--) {
-			fractional *= 10;
+		for (int i = num_digits; i < 6; i++) {
+			micros *= 10;
 		}
-		nanos = fractional;
+		cur += 1 + num_digits;
 	}
 
 	// Handle timezone offset
@@ -74,42 +108,69 @@ Ref<SentryTimestamp> SentryTimestamp::parse_rfc3339_cstr(const char *p_formatted
 		timezone_offset_seconds = 0;
 	} else if (cur[0] == '+' || cur[0] == '-') {
 		// Parse timezone offset (+HH:MM or -HH:MM)
-		int sign = (cur[0] == '+') ? 1 : -1;
-		int offset_hours, offset_minutes;
-
-		if (sscanf(cur, "%*c%2d:%2d%n", &offset_hours, &offset_minutes, &num_consumed) < 2 || num_consumed != 6) {
+		const int offset_hours = _parse_digits(cur + 1, 2);
+		const int offset_minutes = offset_hours < 0 || cur[3] != ':' ? -1 : _parse_digits(cur + 4, 2);
+		if (offset_minutes < 0) {
 			sentry::logging::print_error("Invalid timezone offset format. Expected +HH:MM or -HH:MM");
-			return Ref<SentryTimestamp>();
+			return false;
 		}
-
+		const int sign = (cur[0] == '+') ? 1 : -1;
 		timezone_offset_seconds = sign * (offset_hours * 3600 + offset_minutes * 60);
 	} else {
 		sentry::logging::print_error("Invalid timezone format. Expected 'Z', '+HH:MM', or '-HH:MM'");
-		return Ref<SentryTimestamp>();
+		return false;
 	}
 
-	struct tm tm;
-	tm.tm_year = year - 1900; // tm epoch is 1900
-	tm.tm_mon = month - 1; // months are 0-based
-	tm.tm_mday = day;
-	tm.tm_hour = hour;
-	tm.tm_min = minute;
-	tm.tm_sec = second;
-
-#ifdef WINDOWS_ENABLED
-	time_t time = _mkgmtime(&tm);
-#else
-	time_t time = timegm(&tm);
-#endif
-
-	if (time == -1) {
-		return Ref<SentryTimestamp>();
+	const int64_t seconds = _days_from_civil(year, month, day) * 86'400 + hour * 3600 + minute * 60 + second - timezone_offset_seconds;
+	r_microseconds = seconds * 1'000'000 + micros;
+	return true;
+}
+
+bool SentryTimestamp::format_rfc3339(int64_t p_microseconds, char *r_buffer) {
+	const int64_t secs = _floor_div(p_microseconds, 1'000'000);
+	const int64_t micros = p_microseconds - secs * 1'000'000;
+	int64_t days = _floor_div(secs, 86'400);
+	const int64_t sod = secs - days * 86'400;
+
+	// Civil date from days since epoch (H. Hinnant's civil_from_days).
+	days += 719'468;
+	const int64_t era = _floor_div(days, 146'097);
+	const int64_t doe = days - era * 146'097;
+	const int64_t yoe = (doe - doe / 1'460 + doe / 36'524 - doe / 146'096) / 365;
+	const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	const int64_t mp = (5 * doy + 2) / 153;
+	const int64_t day = doy - (153 * mp + 2) / 5 + 1;
+	const int64_t month = mp < 10 ? mp + 3 : mp - 9;
+	const int64_t year = yoe + era * 400 + (month <= 2);
+
+	if (year < 0 || year > 9999) {
+		return false;
 	}
 
-	// Apply timezone offset to convert to UTC
-	time -= timezone_offset_seconds;
+	// YYYY-MM-DDTHH:MM:SS.ssssssZ
+	_write_digits(r_buffer, year, 4);
+	r_buffer[4] = '-';
+	_write_digits(r_buffer + 5, month, 2);
+	r_buffer[7] = '-';
+	_write_digits(r_buffer + 8, day, 2);
+	r_buffer[10] = 'T';
+	_write_digits(r_buffer + 11, sod / 3600, 2);
+	r_buffer[13] = ':';
+	_write_digits(r_buffer + 14, sod / 60 % 60, 2);
+	r_buffer[16] = ':';
+	_write_digits(r_buffer + 17, sod % 60, 2);
+	r_buffer[19] = '.';
+	_write_digits(r_buffer + 20, micros, 6);
+	r_buffer[26] = 'Z';
+	r_buffer[27] = '\0';
+	return true;
+}
 
-	int64_t microseconds = (int64_t)time * 1000000 + nanos / 1000;
+Ref<SentryTimestamp> SentryTimestamp::parse_rfc3339_cstr(const char *p_formatted_cstring) {
+	int64_t microseconds = 0;
+	if (!parse_rfc3339_usec(p_formatted_cstring, microseconds)) {
+		return Ref<SentryTimestamp>();
+	}
 
 	Ref<SentryTimestamp> timestamp;
 	timestamp.instantiate();
@@ -134,38 +195,12 @@ Ref<SentryTimestamp> SentryTimestamp::from_unix_time(double p_unix_time) {
 }
 
 String SentryTimestamp::to_rfc3339() const {
-	int64_t seconds = microseconds_since_unix_epoch / 1000000;
-	int64_t remaining_microseconds = microseconds_since_unix_epoch % 1000000;
-
-	time_t secs = static_cast<time_t>(seconds);
-	struct tm *tm;
-
-#ifdef WINDOWS_ENABLED
-	struct tm tm_buf;
-	if (gmtime_s(&tm_buf, &secs) != 0) {
-		tm = nullptr;
-	} else {
-		tm = &tm_buf;
-	}
-#else // POSIX
-	struct tm tm_buf;
-	tm = gmtime_r(&secs, &tm_buf);
-#endif
-
-	if (!tm || tm->tm_year > 9000) {
+	char buffer[RFC3339_BUFFER_SIZE];
+	if (!format_rfc3339(microseconds_since_unix_epoch, buffer)) {
 		sentry::logging::print_error("Failed to format timestamp");
 		return String();
 	}
-
-	// YYYY-MM-DDTHH:MM:SS.ssssssZ
-	return vformat("%04d-%02d-%02dT%02d:%02d:%02d.%06dZ",
-			1900 + tm->tm_year,
-			1 + tm->tm_mon, // month is 0-based
-			tm->tm_mday,
-			tm->tm_hour,
-			tm->tm_min,
-			tm->tm_sec,
-			remaining_microseconds);
+	return String(buffer);
 }
 
 void SentryTimestamp::_bind_methods() {
@@ -20,6 +20,17 @@ protected:
 	String _to_string() const { return to_rfc3339(); }
 
 public:
+	// Size of buffer for format_rfc3339(), including the terminating null.
+	static constexpr int RFC3339_BUFFER_SIZE = 28;
+
+	// Parse RFC3339 timestamp into microseconds since Unix epoch, without allocating. Returns false if invalid.
+	// Accepts years 0000-9999, same as format_rfc3339().
+	static bool parse_rfc3339_usec(const char *p_formatted_cstring, int64_t &r_microseconds);
+
+	// Format microseconds since Unix epoch as YYYY-MM-DDTHH:MM:SS.ssssssZ into r_buffer of RFC3339_BUFFER_SIZE.
+	// Returns false if the year is out of the 0-9999 range.
+	static bool format_rfc3339(int64_t p_microseconds, char *r_buffer);
+
 	// Parse RFC3339 timestamp (YYYY-MM-DDTHH:MM:SS.sssssssssZ or with ±HH:MM offset).
 	static Ref<SentryTimestamp> parse_rfc3339_cstr(const char *p_formatted_cstring);
 	static Ref<SentryTimestamp> parse_rfc3339(const String &p_formatted_string) { return parse_rfc3339_cstr(p_formatted_string.ascii()); }
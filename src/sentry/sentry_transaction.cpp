@@ -0,0 +1,9 @@
+#include "sentry_transaction.h"
+
+namespace sentry {
+
+void SentryTransaction::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_name"), &SentryTransaction::get_name);
+}
+
+} //namespace sentry
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "sentry/sentry_span.h"
+
+namespace sentry {
+
+// Root span of a trace, sent to Sentry when finished.
+class SentryTransaction : public SentrySpan {
+	GDCLASS(SentryTransaction, SentrySpan);
+
+protected:
+	static void _bind_methods();
+
+public:
+	virtual String get_name() const = 0;
+
+	virtual ~SentryTransaction() = default;
+};
+
+} //namespace sentry
@@ -0,0 +1,34 @@
+#include "sentry_transport.h"
+
+namespace sentry {
+
+void SentryTransport::send_envelope(const PackedByteArray &p_envelope) {
+	GDVIRTUAL_CALL(_send_envelope, p_envelope);
+}
+
+bool SentryTransport::startup() {
+	bool ret = true;
+	GDVIRTUAL_CALL(_startup, ret);
+	return ret;
+}
+
+bool SentryTransport::flush(int p_timeout_ms) {
+	bool ret = true;
+	GDVIRTUAL_CALL(_flush, p_timeout_ms, ret);
+	return ret;
+}
+
+bool SentryTransport::shutdown(int p_timeout_ms) {
+	bool ret = true;
+	GDVIRTUAL_CALL(_shutdown, p_timeout_ms, ret);
+	return ret;
+}
+
+void SentryTransport::_bind_methods() {
+	GDVIRTUAL_BIND(_startup);
+	GDVIRTUAL_BIND(_send_envelope, "envelope");
+	GDVIRTUAL_BIND(_flush, "timeout_ms");
+	GDVIRTUAL_BIND(_shutdown, "timeout_ms");
+}
+
+} // namespace sentry
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/core/gdvirtual.gen.inc>
+
+using namespace godot;
+
+namespace sentry {
+
+// Base class for transports that route envelopes through user code instead of HTTP
+// (see SentryOptions.transport). Overridable from scripts with the underscored virtual methods,
+// and from C++ by overriding the public ones.
+class SentryTransport : public RefCounted {
+	GDCLASS(SentryTransport, RefCounted);
+
+protected:
+	static void _bind_methods();
+
+	GDVIRTUAL0R(bool, _startup);
+	GDVIRTUAL1(_send_envelope, PackedByteArray);
+	GDVIRTUAL1R(bool, _flush, int);
+	GDVIRTUAL1R(bool, _shutdown, int);
+
+public:
+	// Called from the thread that captures the envelope -- implementations must be thread-safe.
+	virtual void send_envelope(const PackedByteArray &p_envelope);
+
+	virtual bool startup();
+	virtual bool flush(int p_timeout_ms);
+	virtual bool shutdown(int p_timeout_ms);
+};
+
+} // namespace sentry
@@ -0,0 +1,232 @@
+#include "telemetry.h"
+
+#include "sentry/logging/print.h"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/classes/performance.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <iterator>
+
+using namespace godot;
+
+namespace {
+
+using Counter = sentry::telemetry::Counter;
+
+enum MonitorKind {
+	KIND_TOTAL, // cumulative count
+	KIND_RATE, // per second, averaged over at least one second
+	KIND_MSEC, // cumulative time, stored in microseconds
+	KIND_GAUGE, // current value
+};
+
+struct Monitor {
+	const char *id;
+	Counter counter;
+	MonitorKind kind;
+};
+
+const Monitor monitors[] = {
+	{ "sentry/events_captured", sentry::telemetry::EVENTS_CAPTURED, KIND_TOTAL },
+	{ "sentry/events_dropped_limits", sentry::telemetry::EVENTS_DROPPED_LIMITS, KIND_TOTAL },
+	{ "sentry/events_dropped_sampling", sentry::telemetry::EVENTS_DROPPED_SAMPLING, KIND_TOTAL },
+	{ "sentry/events_dropped_before_send", sentry::telemetry::EVENTS_DROPPED_BEFORE_SEND, KIND_TOTAL },
+	{ "sentry/events_dropped_filters", sentry::telemetry::EVENTS_DROPPED_FILTERS, KIND_TOTAL },
+	{ "sentry/logger_suppressed", sentry::telemetry::LOGGER_SUPPRESSED, KIND_TOTAL },
+	{ "sentry/breadcrumbs_per_second", sentry::telemetry::BREADCRUMBS_ADDED, KIND_RATE },
+	{ "sentry/logs_per_second", sentry::telemetry::LOGS_ADDED, KIND_RATE },
+	{ "sentry/bytes_serialized", sentry::telemetry::BYTES_SERIALIZED, KIND_TOTAL },
+	{ "sentry/transport_queue_depth", sentry::telemetry::TRANSPORT_QUEUE_DEPTH, KIND_GAUGE },
+	{ "sentry/envelopes_sent", sentry::telemetry::ENVELOPES_SENT, KIND_TOTAL },
+	{ "sentry/envelopes_dropped_transport", sentry::telemetry::ENVELOPES_DROPPED_TRANSPORT, KIND_TOTAL },
+	{ "sentry/transport_retries", sentry::telemetry::TRANSPORT_RETRIES, KIND_TOTAL },
+	{ "sentry/transport_bytes_saved", sentry::telemetry::TRANSPORT_BYTES_SAVED, KIND_TOTAL },
+	{ "sentry/transport_envelopes_shed", sentry::telemetry::TRANSPORT_ENVELOPES_SHED, KIND_TOTAL },
+	{ "sentry/transport_attachments_shed", sentry::telemetry::TRANSPORT_ATTACHMENTS_SHED, KIND_TOTAL },
+	{ "sentry/transport_bytes_shed", sentry::telemetry::TRANSPORT_BYTES_SHED, KIND_TOTAL },
+	{ "sentry/log_error_time_ms", sentry::telemetry::LOG_ERROR_USEC, KIND_MSEC },
+	{ "sentry/log_message_time_ms", sentry::telemetry::LOG_MESSAGE_USEC, KIND_MSEC },
+	{ "sentry/process_event_time_ms", sentry::telemetry::PROCESS_EVENT_USEC, KIND_MSEC },
+	{ "sentry/error_mutex_wait_ms", sentry::telemetry::ERROR_MUTEX_WAIT_USEC, KIND_MSEC },
+	{ "sentry/screenshot_mutex_wait_ms", sentry::telemetry::SCREENSHOT_MUTEX_WAIT_USEC, KIND_MSEC },
+	{ "sentry/screenshot_capture_time_ms", sentry::telemetry::SCREENSHOT_CAPTURE_USEC, KIND_MSEC },
+	{ "sentry/view_hierarchy_capture_time_ms", sentry::telemetry::VIEW_HIERARCHY_CAPTURE_USEC, KIND_MSEC },
+	{ "sentry/transport_upload_time_ms", sentry::telemetry::TRANSPORT_UPLOAD_USEC, KIND_MSEC },
+	{ "sentry/transport_queue_wait_ms", sentry::telemetry::TRANSPORT_QUEUE_WAIT_USEC, KIND_MSEC },
+};
+
+const char *counter_names[] = {
+	"Events captured",
+	"Events dropped: limits",
+	"Events dropped: sampling",
+	"Events dropped: before_send",
+	"Events dropped: event processors",
+	"Errors suppressed by logger",
+	"Breadcrumbs",
+	"Logs",
+	"Bytes serialized",
+	"Transport queue depth",
+	"Envelopes sent",
+	"Envelopes dropped: transport",
+	"Transport retries",
+	"Bytes saved by compression",
+	"Envelopes shed: byte budget",
+	"Attachments shed: byte budget",
+	"Bytes shed: byte budget",
+	"Logger errors (ms)",
+	"Logger messages (ms)",
+	"Event processing (ms)",
+	"Error mutex wait (ms)",
+	"Screenshot mutex wait (ms)",
+	"Screenshot capture (ms)",
+	"View hierarchy capture (ms)",
+	"Transport upload (ms)",
+	"Transport queue wait (ms)",
+};
+
+static_assert(std::size(counter_names) == sentry::telemetry::COUNTER_MAX);
+
+// Rate state is only touched by the monitor callbacks, which run on the main thread.
+struct RateWindow {
+	int64_t start_msec = 0;
+	int64_t start_value = 0;
+	double rate = 0.0;
+};
+
+RateWindow rate_windows[sentry::telemetry::COUNTER_MAX];
+
+double _get_monitor_value(int p_index) {
+	const Monitor &monitor = monitors[p_index];
+	int64_t value = sentry::telemetry::get(monitor.counter);
+
+	switch (monitor.kind) {
+		case KIND_RATE: {
+			RateWindow &window = rate_windows[monitor.counter];
+			int64_t now = Time::get_singleton()->get_ticks_msec();
+			int64_t elapsed = now - window.start_msec;
+			if (elapsed >= 1000) {
+				window.rate = (value - window.start_value) * 1000.0 / elapsed;
+				window.start_msec = now;
+				window.start_value = value;
+			}
+			return window.rate;
+		}
+		case KIND_MSEC:
+			return value / 1000.0;
+		default:
+			return (double)value;
+	}
+}
+
+int64_t streamed_values[sentry::telemetry::COUNTER_MAX];
+
+void _on_process_frame() {
+	if (!EngineDebugger::get_singleton()->is_active()) {
+		return;
+	}
+
+	Array data;
+	data.resize(1 + sentry::telemetry::COUNTER_MAX);
+	data[0] = (int64_t)Time::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < sentry::telemetry::COUNTER_MAX; i++) {
+		int64_t value = sentry::telemetry::get((Counter)i);
+		data[1 + i] = sentry::telemetry::is_gauge((Counter)i) ? value : value - streamed_values[i];
+		streamed_values[i] = value;
+	}
+	EngineDebugger::get_singleton()->send_message(sentry::telemetry::DEBUGGER_MESSAGE, data);
+}
+
+void _connect_process_frame() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	ERR_FAIL_NULL_MSG(scene_tree, "Sentry: Failed to start debugger stats - expected SceneTree instance as main loop.");
+
+	for (int i = 0; i < sentry::telemetry::COUNTER_MAX; i++) {
+		streamed_values[i] = sentry::telemetry::get((Counter)i);
+	}
+
+	Callable callable = callable_mp_static(&_on_process_frame);
+	if (!scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->connect("process_frame", callable);
+	}
+}
+
+} // unnamed namespace
+
+namespace sentry::telemetry {
+
+std::atomic<int64_t> counters[COUNTER_MAX];
+
+const char *get_counter_name(Counter p_counter) {
+	ERR_FAIL_INDEX_V(p_counter, COUNTER_MAX, "");
+	return counter_names[p_counter];
+}
+
+bool is_time_counter(Counter p_counter) {
+	return p_counter >= LOG_ERROR_USEC && p_counter < COUNTER_MAX;
+}
+
+bool is_gauge(Counter p_counter) {
+	return p_counter == TRANSPORT_QUEUE_DEPTH;
+}
+
+void reset() {
+	for (std::atomic<int64_t> &counter : counters) {
+		counter.store(0, std::memory_order_relaxed);
+	}
+	for (RateWindow &window : rate_windows) {
+		window = RateWindow();
+	}
+}
+
+void register_monitors() {
+	Performance *performance = Performance::get_singleton();
+	ERR_FAIL_NULL(performance);
+
+	for (int i = 0; i < (int)std::size(monitors); i++) {
+		StringName id = monitors[i].id;
+		if (!performance->has_custom_monitor(id)) {
+			performance->add_custom_monitor(id, callable_mp_static(&_get_monitor_value).bind(i));
+		}
+	}
+	sentry::logging::print_debug("Registered performance monitors");
+}
+
+void unregister_monitors() {
+	Performance *performance = Performance::get_singleton();
+	if (performance == nullptr) {
+		return;
+	}
+
+	for (const Monitor &monitor : monitors) {
+		StringName id = monitor.id;
+		if (performance->has_custom_monitor(id)) {
+			performance->remove_custom_monitor(id);
+		}
+	}
+}
+
+void start_debugger_stream() {
+	if (EngineDebugger::get_singleton() == nullptr || !EngineDebugger::get_singleton()->is_active()) {
+		return;
+	}
+
+	if (Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop())) {
+		_connect_process_frame();
+	} else {
+		// SceneTree is not available during early initialization.
+		callable_mp_static(&_connect_process_frame).call_deferred();
+	}
+}
+
+void stop_debugger_stream() {
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	Callable callable = callable_mp_static(&_on_process_frame);
+	if (scene_tree && scene_tree->is_connected("process_frame", callable)) {
+		scene_tree->disconnect("process_frame", callable);
+	}
+}
+
+} //namespace sentry::telemetry
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <godot_cpp/core/defs.hpp>
+#include <mutex>
+
+// Counters describing the work done by the SDK itself. They are exposed as custom monitors
+// under "sentry/" in Godot's Performance singleton (and the debugger's Monitors tab).
+// Updating a counter is a single relaxed atomic add.
+namespace sentry::telemetry {
+
+enum Counter {
+	EVENTS_CAPTURED,
+	EVENTS_DROPPED_LIMITS,
+	EVENTS_DROPPED_SAMPLING,
+	EVENTS_DROPPED_BEFORE_SEND,
+	EVENTS_DROPPED_FILTERS,
+	LOGGER_SUPPRESSED,
+	BREADCRUMBS_ADDED,
+	LOGS_ADDED,
+	BYTES_SERIALIZED,
+	TRANSPORT_QUEUE_DEPTH, // current value, not cumulative
+	ENVELOPES_SENT,
+	ENVELOPES_DROPPED_TRANSPORT,
+	TRANSPORT_RETRIES,
+	TRANSPORT_BYTES_SAVED,
+	TRANSPORT_ENVELOPES_SHED,
+	TRANSPORT_ATTACHMENTS_SHED,
+	TRANSPORT_BYTES_SHED,
+	LOG_ERROR_USEC,
+	LOG_MESSAGE_USEC,
+	PROCESS_EVENT_USEC,
+	ERROR_MUTEX_WAIT_USEC,
+	SCREENSHOT_MUTEX_WAIT_USEC,
+	SCREENSHOT_CAPTURE_USEC,
+	VIEW_HIERARCHY_CAPTURE_USEC,
+	TRANSPORT_UPLOAD_USEC,
+	TRANSPORT_QUEUE_WAIT_USEC,
+	COUNTER_MAX,
+};
+
+extern std::atomic<int64_t> counters[COUNTER_MAX];
+
+_FORCE_INLINE_ void add(Counter p_counter, int64_t p_value = 1) {
+	counters[p_counter].fetch_add(p_value, std::memory_order_relaxed);
+}
+
+_FORCE_INLINE_ int64_t get(Counter p_counter) {
+	return counters[p_counter].load(std::memory_order_relaxed);
+}
+
+// Human-readable counter name, as shown in the editor's debugger panel.
+const char *get_counter_name(Counter p_counter);
+
+// Returns true if the counter accumulates time in microseconds.
+bool is_time_counter(Counter p_counter);
+
+// Returns true if the counter holds a current level, such as queue depth, rather than a cumulative count.
+bool is_gauge(Counter p_counter);
+
+void reset();
+
+// Adds custom monitors to Performance singleton. Must be called on the main thread.
+void register_monitors();
+void unregister_monitors();
+
+// While a debugger session is active, sends per-frame counter deltas to the editor as
+// DEBUGGER_MESSAGE, with data: [ticks_usec, <delta for each counter>...]. Gauges are sent as their current value.
+constexpr const char *DEBUGGER_MESSAGE = "sentry:frame_stats";
+void start_debugger_stream();
+void stop_debugger_stream();
+
+// Adds the time spent in the scope to a counter (in microseconds).
+class ScopedTimer {
+	Counter counter;
+	std::chrono::steady_clock::time_point start;
+
+public:
+	ScopedTimer(Counter p_counter) :
+			counter(p_counter), start(std::chrono::steady_clock::now()) {}
+
+	~ScopedTimer() {
+		auto elapsed = std::chrono::steady_clock::now() - start;
+		add(counter, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+	}
+};
+
+// Locks p_mutex, adding the time spent waiting to p_counter. Uncontended locks aren't timed.
+inline std::unique_lock<std::mutex> lock_measured(std::mutex &p_mutex, Counter p_counter) {
+	std::unique_lock<std::mutex> lock{ p_mutex, std::try_to_lock };
+	if (!lock.owns_lock()) {
+		ScopedTimer timer{ p_counter };
+		lock.lock();
+	}
+	return lock;
+}
+
+} //namespace sentry::telemetry
@@ -0,0 +1,147 @@
+#include "thread_locations.h"
+
+#include <atomic>
+#include <cstring>
+#include <godot_cpp/classes/os.hpp>
+
+namespace {
+
+using Record = sentry::thread_locations::Record;
+
+struct Slot {
+	std::atomic<uint64_t> owner{ 0 };
+	// Odd while the owning thread is writing.
+	std::atomic<uint32_t> sequence{ 0 };
+	Record record;
+};
+
+Slot slots[sentry::thread_locations::MAX_SLOTS];
+
+// Releases slot when the owning thread exits.
+struct SlotHandle {
+	Slot *slot = nullptr;
+	bool exhausted = false;
+
+	~SlotHandle() {
+		if (slot) {
+			slot->owner.store(0, std::memory_order_release);
+		}
+	}
+};
+
+thread_local SlotHandle slot_handle;
+
+Slot *_get_thread_slot() {
+	if (likely(slot_handle.slot) || slot_handle.exhausted) {
+		return slot_handle.slot;
+	}
+
+	ERR_FAIL_NULL_V(OS::get_singleton(), nullptr);
+	uint64_t thread_id = OS::get_singleton()->get_thread_caller_id();
+
+	for (Slot &slot : slots) {
+		uint64_t expected = 0;
+		if (slot.owner.compare_exchange_strong(expected, thread_id, std::memory_order_acq_rel)) {
+			slot.sequence.fetch_add(1, std::memory_order_acq_rel);
+			slot.record = Record();
+			slot.record.thread_id = thread_id;
+			if (thread_id == OS::get_singleton()->get_main_thread_id()) {
+				strcpy(slot.record.label, "main");
+			}
+			slot.sequence.fetch_add(1, std::memory_order_release);
+			slot_handle.slot = &slot;
+			return &slot;
+		}
+	}
+
+	// All slots are taken -- this thread won't be tracked.
+	slot_handle.exhausted = true;
+	return nullptr;
+}
+
+// Copies UTF-8 string, truncating at a character boundary if it doesn't fit.
+void _copy_truncated(char *p_dest, size_t p_capacity, const CharString &p_src) {
+	size_t length = p_src.length();
+	if (length >= p_capacity) {
+		length = p_capacity - 1;
+		while (length > 0 && (p_src[length] & 0xC0) == 0x80) {
+			length--;
+		}
+	}
+	memcpy(p_dest, p_src.get_data(), length);
+	p_dest[length] = '\0';
+}
+
+class WriteScope {
+	Slot *slot;
+
+public:
+	WriteScope(Slot *p_slot) :
+			slot(p_slot) { slot->sequence.fetch_add(1, std::memory_order_acq_rel); }
+	~WriteScope() { slot->sequence.fetch_add(1, std::memory_order_release); }
+};
+
+} // unnamed namespace
+
+namespace sentry::thread_locations {
+
+void set_label(const String &p_label) {
+	Slot *slot = _get_thread_slot();
+	if (slot) {
+		CharString label = p_label.utf8();
+		WriteScope scope{ slot };
+		_copy_truncated(slot->record.label, LABEL_SIZE, label);
+	}
+}
+
+void set_script_location(const String &p_file, const String &p_function, int32_t p_line) {
+	Slot *slot = _get_thread_slot();
+	if (slot) {
+		CharString file = p_file.utf8();
+		CharString function = p_function.utf8();
+		WriteScope scope{ slot };
+		_copy_truncated(slot->record.file, FILE_SIZE, file);
+		_copy_truncated(slot->record.function, FUNCTION_SIZE, function);
+		slot->record.line = p_line;
+	}
+}
+
+void set_scene(const String &p_scene) {
+	Slot *slot = _get_thread_slot();
+	if (slot) {
+		CharString scene = p_scene.utf8();
+		WriteScope scope{ slot };
+		_copy_truncated(slot->record.scene, SCENE_SIZE, scene);
+	}
+}
+
+bool read_slot(int p_index, Record &r_record) {
+	if (p_index < 0 || p_index >= MAX_SLOTS) {
+		return false;
+	}
+
+	const Slot &slot = slots[p_index];
+	if (slot.owner.load(std::memory_order_acquire) == 0) {
+		return false;
+	}
+
+	// Retry a few times if a write is in progress. If the writer is the crashed thread,
+	// it will never finish, so settle for a possibly torn copy.
+	for (int attempt = 0; attempt < 3; attempt++) {
+		uint32_t before = slot.sequence.load(std::memory_order_acquire);
+		memcpy(&r_record, &slot.record, sizeof(Record));
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if ((before & 1) == 0 && slot.sequence.load(std::memory_order_relaxed) == before) {
+			break;
+		}
+	}
+
+	// Make sure strings are terminated even in a torn copy.
+	r_record.label[LABEL_SIZE - 1] = '\0';
+	r_record.file[FILE_SIZE - 1] = '\0';
+	r_record.function[FUNCTION_SIZE - 1] = '\0';
+	r_record.scene[SCENE_SIZE - 1] = '\0';
+	return true;
+}
+
+} //namespace sentry::thread_locations
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <godot_cpp/variant/string.hpp>
+
+using namespace godot;
+
+// Per-thread records of the most recent script location, for native crash reports.
+// Each thread claims a fixed-size slot on first update. Writers use a sequence counter,
+// so that the crash handler can read slots without locks or allocations.
+namespace sentry::thread_locations {
+
+constexpr int MAX_SLOTS = 64;
+constexpr size_t LABEL_SIZE = 64;
+constexpr size_t FILE_SIZE = 256;
+constexpr size_t FUNCTION_SIZE = 128;
+constexpr size_t SCENE_SIZE = 256;
+
+// Plain copy of a slot, filled by read_slot().
+struct Record {
+	uint64_t thread_id = 0;
+	char label[LABEL_SIZE] = {};
+	char file[FILE_SIZE] = {};
+	char function[FUNCTION_SIZE] = {};
+	int32_t line = 0;
+	char scene[SCENE_SIZE] = {};
+};
+
+// Updates records of the calling thread.
+void set_label(const String &p_label);
+void set_script_location(const String &p_file, const String &p_function, int32_t p_line);
+void set_scene(const String &p_scene);
+
+// Copies slot contents into r_record. Returns false if the slot is unused.
+// Safe to call from a crash handler.
+bool read_slot(int p_index, Record &r_record);
+
+} //namespace sentry::thread_locations
@@ -0,0 +1,167 @@
+#include "envelope_uploader.h"
+
+#include "gen/sdk_version.gen.h"
+#include "sentry/logging/print.h"
+#include "sentry/telemetry.h"
+
+#include <chrono>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/tls_options.hpp>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int64_t REQUEST_TIMEOUT_MSEC = 30'000;
+
+// Returns delay requested by the server with Retry-After or X-Sentry-Rate-Limits header.
+int64_t _get_retry_after_msec(const PackedStringArray &p_headers) {
+	for (const String &header : p_headers) {
+		String lower = header.to_lower();
+		if (lower.begins_with("retry-after:") || lower.begins_with("x-sentry-rate-limits:")) {
+			// Rate limits format: "{seconds}:{categories}:{scope}, ..." -- the first limit is enough here.
+			String value = header.get_slice(":", 1).strip_edges();
+			if (value.is_valid_int()) {
+				return value.to_int() * 1000;
+			}
+		}
+	}
+	return 0;
+}
+
+} // unnamed namespace
+
+namespace sentry::util {
+
+// DSN format: {scheme}://{public_key}@{host}[:{port}]/[{path}/]{project_id}
+Endpoint Endpoint::from_dsn(const String &p_dsn) {
+	Endpoint endpoint;
+
+	int scheme_end = p_dsn.find("://");
+	int at = p_dsn.find("@");
+	if (scheme_end < 0 || at < scheme_end) {
+		return endpoint;
+	}
+	String scheme = p_dsn.substr(0, scheme_end);
+	String public_key = p_dsn.substr(scheme_end + 3, at - scheme_end - 3).get_slice(":", 0);
+
+	String rest = p_dsn.substr(at + 1);
+	int slash = rest.find("/");
+	if (slash < 0) {
+		return endpoint;
+	}
+	String host_port = rest.substr(0, slash);
+	String path = rest.substr(slash).trim_suffix("/");
+	int last_slash = path.rfind("/");
+	String project_id = path.substr(last_slash + 1);
+	String path_prefix = path.substr(0, last_slash);
+	if (public_key.is_empty() || host_port.is_empty() || project_id.is_empty()) {
+		return endpoint;
+	}
+
+	endpoint.tls = scheme == "https";
+	int colon = host_port.rfind(":");
+	if (colon > 0 && !host_port.ends_with("]")) {
+		endpoint.host = host_port.substr(0, colon);
+		endpoint.port = host_port.substr(colon + 1).to_int();
+	} else {
+		endpoint.host = host_port;
+		endpoint.port = endpoint.tls ? 443 : 80;
+	}
+	endpoint.path = path_prefix + "/api/" + project_id + "/envelope/";
+	endpoint.auth_header = vformat("X-Sentry-Auth: Sentry sentry_key=%s, sentry_version=7, sentry_client=sentry.native.godot/%s",
+			public_key, SENTRY_GODOT_SDK_VERSION);
+	endpoint.valid = true;
+	return endpoint;
+}
+
+bool EnvelopeUploader::_poll_while(HTTPClient::Status p_status, HTTPClient::Status p_status2) {
+	Clock::time_point deadline = Clock::now() + std::chrono::milliseconds{ REQUEST_TIMEOUT_MSEC };
+	while (http->get_status() == p_status || http->get_status() == p_status2) {
+		if (_is_aborted() || Clock::now() > deadline) {
+			return false;
+		}
+		http->poll();
+		OS::get_singleton()->delay_usec(1000);
+	}
+	return true;
+}
+
+bool EnvelopeUploader::_connect() {
+	http->close();
+	Error err = http->connect_to_host(endpoint.host, endpoint.port, endpoint.tls ? TLSOptions::client() : Ref<TLSOptions>());
+	if (err != OK || !_poll_while(HTTPClient::STATUS_RESOLVING, HTTPClient::STATUS_CONNECTING) ||
+			http->get_status() != HTTPClient::STATUS_CONNECTED) {
+		sentry::logging::print_debug("Transport failed to connect to ", endpoint.host);
+		http->close();
+		return false;
+	}
+	return true;
+}
+
+bool EnvelopeUploader::_request(const PackedByteArray &p_body, const String &p_encoding) {
+	PackedStringArray headers;
+	headers.push_back("Content-Type: application/x-sentry-envelope");
+	headers.push_back(endpoint.auth_header);
+	if (!p_encoding.is_empty()) {
+		headers.push_back("Content-Encoding: " + p_encoding);
+	}
+	Error err = http->request_raw(HTTPClient::METHOD_POST, endpoint.path, headers, p_body);
+	return err == OK && _poll_while(HTTPClient::STATUS_REQUESTING, HTTPClient::STATUS_REQUESTING) && http->has_response();
+}
+
+EnvelopeUploader::Result EnvelopeUploader::upload(const PackedByteArray &p_body, const String &p_encoding, int64_t &r_retry_after_msec) {
+	sentry::telemetry::ScopedTimer timer{ sentry::telemetry::TRANSPORT_UPLOAD_USEC };
+
+	if (http.is_null()) {
+		http.instantiate();
+		http->set_blocking_mode(true);
+	}
+
+	// Connection is kept alive between requests. The server may close it in the meantime,
+	// so a request that fails on a reused connection is repeated once on a new one.
+	bool reused = http->get_status() == HTTPClient::STATUS_CONNECTED;
+	if (!reused && !_connect()) {
+		return UPLOAD_RETRY;
+	}
+	bool ok = _request(p_body, p_encoding);
+	if (!ok && reused && !_is_aborted()) {
+		ok = _connect() && _request(p_body, p_encoding);
+	}
+	if (!ok) {
+		http->close();
+		return UPLOAD_RETRY;
+	}
+
+	int code = http->get_response_code();
+	PackedStringArray response_headers = http->get_response_headers();
+
+	// Read the body, so that the connection can be reused.
+	Clock::time_point deadline = Clock::now() + std::chrono::milliseconds{ REQUEST_TIMEOUT_MSEC };
+	while (http->get_status() == HTTPClient::STATUS_BODY) {
+		if (_is_aborted() || Clock::now() > deadline) {
+			http->close();
+			break;
+		}
+		http->poll();
+		http->read_response_body_chunk();
+	}
+
+	if (code >= 200 && code < 300) {
+		return UPLOAD_SENT;
+	}
+	sentry::logging::print_debug("Transport received HTTP ", code);
+	if (code == 429 || code >= 500) {
+		r_retry_after_msec = _get_retry_after_msec(response_headers);
+		return UPLOAD_RETRY;
+	}
+	return UPLOAD_REJECTED;
+}
+
+void EnvelopeUploader::close() {
+	if (http.is_valid()) {
+		http->close();
+	}
+}
+
+} //namespace sentry::util
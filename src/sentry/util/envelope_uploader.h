@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <godot_cpp/classes/http_client.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+using namespace godot;
+
+namespace sentry::util {
+
+// Ingestion endpoint derived from a DSN.
+struct Endpoint {
+	String host;
+	int port = 0;
+	bool tls = false;
+	String path;
+	String auth_header;
+	bool valid = false;
+
+	static Endpoint from_dsn(const String &p_dsn);
+};
+
+// Uploads serialized envelopes to ingestion with blocking requests over a kept-alive connection.
+// Not thread-safe -- each thread should use its own uploader.
+class EnvelopeUploader {
+public:
+	enum Result {
+		UPLOAD_SENT,
+		UPLOAD_REJECTED, // won't succeed on retry -- drop it
+		UPLOAD_RETRY,
+	};
+
+private:
+	Endpoint endpoint;
+	Ref<HTTPClient> http;
+	const std::atomic<bool> *abort = nullptr;
+
+	bool _is_aborted() const { return abort && abort->load(std::memory_order_relaxed); }
+	bool _poll_while(HTTPClient::Status p_status, HTTPClient::Status p_status2);
+	bool _connect();
+	bool _request(const PackedByteArray &p_body, const String &p_encoding);
+
+public:
+	// On retry, r_retry_after_msec is set to the delay requested by the server, if any.
+	Result upload(const PackedByteArray &p_body, const String &p_encoding, int64_t &r_retry_after_msec);
+	void close();
+
+	// Pending requests are cancelled when p_abort is set.
+	EnvelopeUploader(const Endpoint &p_endpoint, const std::atomic<bool> *p_abort = nullptr) :
+			endpoint(p_endpoint), abort(p_abort) {}
+	~EnvelopeUploader() { close(); }
+};
+
+} //namespace sentry::util
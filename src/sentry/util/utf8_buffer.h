@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <godot_cpp/variant/string.hpp>
 
 namespace sentry::util {
@@ -23,6 +24,25 @@ private:
 		}
 	}
 
+	// Writes a single code point as UTF-8. Caller must ensure capacity.
+	_FORCE_INLINE_ void _write_utf8(char32_t c) {
+		if (c <= 0x7F) { // 1 byte
+			*(write++) = static_cast<char>(c);
+		} else if (c <= 0x7FF) { // 2 bytes
+			*(write++) = static_cast<char>(0xC0 | ((c >> 6) & 0x1F)); // top 5 bits
+			*(write++) = static_cast<char>(0x80 | (c & 0x3F)); // bottom 6 bits
+		} else if (c <= 0xFFFF) { // 3 bytes
+			*(write++) = static_cast<char>(0xE0 | ((c >> 12) & 0x0F)); // top 4 bits
+			*(write++) = static_cast<char>(0x80 | ((c >> 6) & 0x3F)); // middle 6 bits
+			*(write++) = static_cast<char>(0x80 | (c & 0x3F)); // bottom 6 bits
+		} else { // 4 bytes
+			*(write++) = static_cast<char>(0xF0 | ((c >> 18) & 0x07)); // top 3 bits
+			*(write++) = static_cast<char>(0x80 | ((c >> 12) & 0x3F)); // upper middle 6 bits
+			*(write++) = static_cast<char>(0x80 | ((c >> 6) & 0x3F)); // lower middle 6 bits
+			*(write++) = static_cast<char>(0x80 | (c & 0x3F)); // bottom 6 bits
+		}
+	}
+
 public:
 	UTF8Buffer(size_t p_capacity = 4096) {
 		if (p_capacity > 0) {
@@ -73,15 +93,13 @@ public:
 	}
 
 	void append(const char *p_cstr) {
-		const size_t length = strlen(p_cstr);
-		_ensure_capacity(get_size() + length + 1);
-
-		const char *src = p_cstr;
-		const char *end = p_cstr + length;
+		append(p_cstr, strlen(p_cstr));
+	}
 
-		for (; src < end; ++src, ++write) {
-			*write = static_cast<uint8_t>(*src);
-		}
+	void append(const char *p_data, size_t p_length) {
+		_ensure_capacity(get_size() + p_length + 1);
+		memcpy(write, p_data, p_length);
+		write += p_length;
 	}
 
 	void append(const godot::String &p_str) {
@@ -89,23 +107,56 @@ public:
 		_ensure_capacity(get_size() + length * 4 + 1); // ensure maximum theoretical
 
 		// To UTF-8
+		const char32_t *read = p_str.ptr();
+		for (size_t i = 0; i < length; ++i) {
+			_write_utf8(read[i]);
+		}
+	}
+
+	// Appends string contents escaped for use inside a JSON string literal (without quotes).
+	void append_json_escaped(const godot::String &p_str) {
+		static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+		const size_t length = p_str.length();
+		_ensure_capacity(get_size() + length * 6 + 1); // "\u00XX" is the longest encoding per character
+
 		const char32_t *read = p_str.ptr();
 		for (size_t i = 0; i < length; ++i) {
 			char32_t c = read[i];
-			if (c <= 0x7F) { // 1 byte
-				*(write++) = static_cast<char>(c);
-			} else if (c <= 0x7FF) { // 2 bytes
-				*(write++) = static_cast<char>(0xC0 | ((c >> 6) & 0x1F)); // top 5 bits
-				*(write++) = static_cast<char>(0x80 | (c & 0x3F)); // bottom 6 bits
-			} else if (c <= 0xFFFF) { // 3 bytes
-				*(write++) = static_cast<char>(0xE0 | ((c >> 12) & 0x0F)); // top 4 bits
-				*(write++) = static_cast<char>(0x80 | ((c >> 6) & 0x3F)); // middle 6 bits
-				*(write++) = static_cast<char>(0x80 | (c & 0x3F)); // bottom 6 bits
-			} else { // 4 bytes
-				*(write++) = static_cast<char>(0xF0 | ((c >> 18) & 0x07)); // top 3 bits
-				*(write++) = static_cast<char>(0x80 | ((c >> 12) & 0x3F)); // upper middle 6 bits
-				*(write++) = static_cast<char>(0x80 | ((c >> 6) & 0x3F)); // lower middle 6 bits
-				*(write++) = static_cast<char>(0x80 | (c & 0x3F)); // bottom 6 bits
+			if (c >= 0x20 && c != '"' && c != '\\') {
+				_write_utf8(c);
+				continue;
+			}
+			*(write++) = '\\';
+			switch (c) {
+				case '"':
+					*(write++) = '"';
+					break;
+				case '\\':
+					*(write++) = '\\';
+					break;
+				case '\n':
+					*(write++) = 'n';
+					break;
+				case '\r':
+					*(write++) = 'r';
+					break;
+				case '\t':
+					*(write++) = 't';
+					break;
+				case '\b':
+					*(write++) = 'b';
+					break;
+				case '\f':
+					*(write++) = 'f';
+					break;
+				default:
+					*(write++) = 'u';
+					*(write++) = '0';
+					*(write++) = '0';
+					*(write++) = HEX_DIGITS[(c >> 4) & 0xF];
+					*(write++) = HEX_DIGITS[c & 0xF];
+					break;
 			}
 		}
 	}
@@ -1,36 +1,94 @@
 #include "uuid.h"
 
+#include <chrono>
+#include <functional>
 #include <random>
-
-#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <thread>
 
 namespace {
 
-inline PackedByteArray _generate_uuid_v4() {
-	PackedByteArray data;
-	data.resize(16);
-	std::random_device rd;
-	std::mt19937 gen{ rd() };
-	std::uniform_int_distribution<int> dist{ 0, 255 }; // Limits
-	for (int i = 0; i < 16; i++) {
-		data[i] = ((unsigned char)dist(gen));
+inline uint64_t _rotl(uint64_t p_x, int p_k) {
+	return (p_x << p_k) | (p_x >> (64 - p_k));
+}
+
+inline uint64_t _splitmix64(uint64_t &r_state) {
+	uint64_t z = (r_state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+// xoshiro256** by David Blackman and Sebastiano Vigna.
+// Constructing std::random_device can cost a syscall, and std::mt19937 carries about 5 KB of state,
+// so instead each thread seeds this generator once and keeps it.
+struct Xoshiro256 {
+	uint64_t s[4];
+
+	Xoshiro256() {
+		std::random_device rd;
+		uint64_t seed = (uint64_t(rd()) << 32) ^ rd();
+		// Mixed with time and thread ID in case random_device is deterministic on this platform.
+		seed ^= uint64_t(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+		seed ^= uint64_t(std::hash<std::thread::id>{}(std::this_thread::get_id())) << 1;
+		for (uint64_t &word : s) {
+			word = _splitmix64(seed) ^ rd();
+		}
+	}
+
+	inline uint64_t next() {
+		const uint64_t result = _rotl(s[1] * 5, 7) * 9;
+		const uint64_t t = s[1] << 17;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = _rotl(s[3], 45);
+		return result;
+	}
+};
+
+thread_local Xoshiro256 generator;
+
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+// Writes p_count bytes of p_bits, most significant first, as hex digits.
+inline char *_write_hex(char *p_out, uint64_t p_bits, int p_count) {
+	for (int i = p_count - 1; i >= 0; i--) {
+		const uint8_t byte = uint8_t(p_bits >> (i * 8));
+		*p_out++ = HEX_DIGITS[byte >> 4];
+		*p_out++ = HEX_DIGITS[byte & 0x0F];
 	}
-	data[6] = (data[6] & 0x0F) | 0x40; // Version 4
-	data[8] = (data[8] & 0x3F) | 0x80; // Variant 10xx
-	return data;
+	return p_out;
 }
 
-constexpr const char *FORMAT_WITH_DASHES = "%02x%02x%02x%02x-%02x%02x-%02x%02x-%02x%02x-%02x%02x%02x%02x%02x%02x";
-constexpr const char *FORMAT_NO_DASHES = "%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x";
+inline String _make_uuid_v4(bool p_dashes) {
+	uint64_t hi = generator.next();
+	uint64_t lo = generator.next();
+	hi = (hi & ~0xF000ull) | 0x4000ull; // Version 4
+	lo = (lo & ~(0xC0ull << 56)) | (0x80ull << 56); // Variant 10xx
 
-inline String _uuid_to_string(const PackedByteArray &p_uuid, const char *p_format) {
+	// Layout: 8-4-4-4-12 hex digits.
 	char buffer[37];
-	std::snprintf(buffer, sizeof(buffer), p_format,
-			p_uuid[0], p_uuid[1], p_uuid[2], p_uuid[3],
-			p_uuid[4], p_uuid[5],
-			p_uuid[6], p_uuid[7],
-			p_uuid[8], p_uuid[9],
-			p_uuid[10], p_uuid[11], p_uuid[12], p_uuid[13], p_uuid[14], p_uuid[15]);
+	char *p = buffer;
+	p = _write_hex(p, hi >> 32, 4);
+	if (p_dashes) {
+		*p++ = '-';
+	}
+	p = _write_hex(p, hi >> 16, 2);
+	if (p_dashes) {
+		*p++ = '-';
+	}
+	p = _write_hex(p, hi, 2);
+	if (p_dashes) {
+		*p++ = '-';
+	}
+	p = _write_hex(p, lo >> 48, 2);
+	if (p_dashes) {
+		*p++ = '-';
+	}
+	p = _write_hex(p, lo, 6);
+	*p = '\0';
 	return String(buffer);
 }
 
@@ -38,12 +96,16 @@ inline String _uuid_to_string(const PackedByteArray &p_uuid, const char *p_forma
 
 namespace sentry::uuid {
 
+uint64_t random_u64() {
+	return generator.next();
+}
+
 String make_uuid() {
-	return _uuid_to_string(_generate_uuid_v4(), FORMAT_WITH_DASHES);
+	return _make_uuid_v4(true);
 }
 
 String make_uuid_no_dashes() {
-	return _uuid_to_string(_generate_uuid_v4(), FORMAT_NO_DASHES);
+	return _make_uuid_v4(false);
 }
 
 } // namespace sentry::uuid
@@ -1,12 +1,18 @@
 #ifndef UUID_H
 #define UUID_H
 
+#include <cstdint>
+
 #include <godot_cpp/variant/string.hpp>
 
 using namespace godot;
 
 namespace sentry::uuid {
 
+// Returns 64 random bits from a fast generator (xoshiro256**) owned by the calling thread.
+// Seeded once per thread from std::random_device. Not suitable for cryptographic use.
+uint64_t random_u64();
+
 String make_uuid();
 String make_uuid_no_dashes();
 